@@ -3,6 +3,127 @@
 #include "DataSource/GameSettingDataSourceDynamic.h"
 
 #include "Engine/LocalPlayer.h"
+#include "GameSettingProfiling.h"
+#include "HAL/IConsoleManager.h"
+#include "UObject/EnumProperty.h"
+
+DECLARE_CYCLE_STAT(TEXT("DataSourceDynamic GetValueAsString"), STAT_GameSettingDataSourceDynamic_GetValueAsString, STATGROUP_GameSettings);
+DECLARE_CYCLE_STAT(TEXT("DataSourceDynamic SetValue"), STAT_GameSettingDataSourceDynamic_SetValue, STATGROUP_GameSettings);
+
+namespace GameSettingDataSourceDynamic
+{
+	static bool bUseCompiledAccessors = true;
+
+	static FAutoConsoleVariableRef CVarUseCompiledAccessors(
+		TEXT("GameSettings.CompiledDataSources"),
+		bUseCompiledAccessors,
+		TEXT("Should dynamic data sources read and write through accessors compiled from their property path, rather than walking the path every time."),
+		ECVF_Default);
+
+#if !UE_BUILD_SHIPPING
+	/** Every dynamic data source, so they can be benchmarked. */
+	static TArray<const FGameSettingDataSourceDynamic*> AllDataSources;
+#endif
+
+	/** Calls a function that takes no parameters and returns an object. */
+	static UObject* CallObjectGetter(UObject* InContainer, UFunction* InFunction)
+	{
+		UObject* Result = nullptr;
+		InContainer->ProcessEvent(InFunction, &Result);
+		return Result;
+	}
+
+	/** How each typed value maps onto the properties that can hold it. */
+	template<typename ValueType>
+	struct TTypedAccess;
+
+	template<>
+	struct TTypedAccess<bool>
+	{
+		static bool Supports(const FProperty* Property) { return Property->IsA<FBoolProperty>(); }
+		static bool Read(const FProperty* Property, const void* Value) { return CastFieldChecked<FBoolProperty>(Property)->GetPropertyValue(Value); }
+		static void Write(const FProperty* Property, void* Value, bool InValue) { CastFieldChecked<FBoolProperty>(Property)->SetPropertyValue(Value, InValue); }
+	};
+
+	template<>
+	struct TTypedAccess<int64>
+	{
+		static const FNumericProperty* GetNumericProperty(const FProperty* Property)
+		{
+			if (const FEnumProperty* EnumProperty = CastField<FEnumProperty>(Property))
+			{
+				return EnumProperty->GetUnderlyingProperty();
+			}
+
+			const FNumericProperty* NumericProperty = CastField<FNumericProperty>(Property);
+			return NumericProperty && NumericProperty->IsInteger() ? NumericProperty : nullptr;
+		}
+
+		static bool Supports(const FProperty* Property) { return GetNumericProperty(Property) != nullptr; }
+		static int64 Read(const FProperty* Property, const void* Value) { return GetNumericProperty(Property)->GetSignedIntPropertyValue(Value); }
+		static void Write(const FProperty* Property, void* Value, int64 InValue) { GetNumericProperty(Property)->SetIntPropertyValue(Value, InValue); }
+	};
+
+	template<>
+	struct TTypedAccess<double>
+	{
+		// Integer properties are left to the string path, which parses "1.5" the way it always has.
+		static bool Supports(const FProperty* Property)
+		{
+			const FNumericProperty* NumericProperty = CastField<FNumericProperty>(Property);
+			return NumericProperty && NumericProperty->IsFloatingPoint();
+		}
+
+		static double Read(const FProperty* Property, const void* Value) { return CastFieldChecked<FNumericProperty>(Property)->GetFloatingPointPropertyValue(Value); }
+		static void Write(const FProperty* Property, void* Value, double InValue) { CastFieldChecked<FNumericProperty>(Property)->SetFloatingPointPropertyValue(Value, InValue); }
+	};
+
+	template<typename StructType>
+	struct TTypedStructAccess
+	{
+		static bool Supports(const FProperty* Property)
+		{
+			const FStructProperty* StructProperty = CastField<FStructProperty>(Property);
+			return StructProperty && StructProperty->Struct == TBaseStructure<StructType>::Get();
+		}
+
+		static StructType Read(const FProperty* Property, const void* Value) { return *static_cast<const StructType*>(Value); }
+		static void Write(const FProperty* Property, void* Value, const StructType& InValue) { *static_cast<StructType*>(Value) = InValue; }
+	};
+
+	template<> struct TTypedAccess<FLinearColor> : TTypedStructAccess<FLinearColor> { };
+	template<> struct TTypedAccess<FVector2D> : TTypedStructAccess<FVector2D> { };
+
+	/** Parameters for calling a function, initialized and destroyed with the function's parameter properties. */
+	class FFunctionParams : public FNoncopyable
+	{
+	public:
+		explicit FFunctionParams(UFunction* InFunction)
+			: Function(InFunction)
+			, Memory(InFunction->ParmsSize > 0 ? (uint8*)FMemory::Malloc(InFunction->ParmsSize, InFunction->GetMinAlignment()) : nullptr)
+		{
+			if (Memory)
+			{
+				Function->InitializeStruct(Memory);
+			}
+		}
+
+		~FFunctionParams()
+		{
+			if (Memory)
+			{
+				Function->DestroyStruct(Memory);
+				FMemory::Free(Memory);
+			}
+		}
+
+		uint8* Get() const { return Memory; }
+
+	private:
+		UFunction* Function;
+		uint8* Memory;
+	};
+}
 
 //--------------------------------------
 // FGameSettingDataSourceDynamic
@@ -11,17 +132,49 @@
 FGameSettingDataSourceDynamic::FGameSettingDataSourceDynamic(const TArray<FString>& InDynamicPath)
 	: DynamicPath(InDynamicPath)
 {
+	SegmentNames.Reserve(InDynamicPath.Num());
+	for (const FString& Segment : InDynamicPath)
+	{
+		SegmentNames.Add(FName(*Segment));
+	}
+
+#if !UE_BUILD_SHIPPING
+	GameSettingDataSourceDynamic::AllDataSources.Add(this);
+#endif
+}
+
+#if !UE_BUILD_SHIPPING
+FGameSettingDataSourceDynamic::~FGameSettingDataSourceDynamic()
+{
+	GameSettingDataSourceDynamic::AllDataSources.RemoveSingleSwap(this);
 }
+#endif
 
 bool FGameSettingDataSourceDynamic::Resolve(ULocalPlayer* InLocalPlayer)
 {
-	return DynamicPath.Resolve(InLocalPlayer);
+	const bool bResolved = DynamicPath.Resolve(InLocalPlayer);
+	if (bResolved && GameSettingDataSourceDynamic::bUseCompiledAccessors)
+	{
+		CompileAccessors(InLocalPlayer);
+	}
+
+	return bResolved;
 }
 
 FString FGameSettingDataSourceDynamic::GetValueAsString(ULocalPlayer* InLocalPlayer) const
 {
+	SCOPE_CYCLE_COUNTER(STAT_GameSettingDataSourceDynamic_GetValueAsString);
+
 	FString OutStringValue;
 
+	if (GameSettingDataSourceDynamic::bUseCompiledAccessors && AreAccessorsCompiledFor(InLocalPlayer))
+	{
+		const bool bSuccess = GetCompiledValueAsString(InLocalPlayer, OutStringValue);
+		ensure(bSuccess);
+
+		return OutStringValue;
+	}
+
 	const bool bSuccess = PropertyPathHelpers::GetPropertyValueAsString(InLocalPlayer, DynamicPath, OutStringValue);
 	ensure(bSuccess);
 
@@ -30,6 +183,16 @@ FString FGameSettingDataSourceDynamic::GetValueAsString(ULocalPlayer* InLocalPla
 
 void FGameSettingDataSourceDynamic::SetValue(ULocalPlayer* InLocalPlayer, const FString& InStringValue)
 {
+	SCOPE_CYCLE_COUNTER(STAT_GameSettingDataSourceDynamic_SetValue);
+
+	if (GameSettingDataSourceDynamic::bUseCompiledAccessors && AreAccessorsCompiledFor(InLocalPlayer))
+	{
+		const bool bSuccess = SetCompiledValue(InLocalPlayer, InStringValue);
+		ensure(bSuccess);
+
+		return;
+	}
+
 	const bool bSuccess = PropertyPathHelpers::SetPropertyValueFromString(InLocalPlayer, DynamicPath, InStringValue);
 	ensure(bSuccess);
 }
@@ -38,3 +201,372 @@ FString FGameSettingDataSourceDynamic::ToString() const
 {
 	return DynamicPath.ToString();
 }
+
+bool FGameSettingDataSourceDynamic::AreAccessorsCompiledFor(UObject* InRoot) const
+{
+	if (!InRoot)
+	{
+		return false;
+	}
+
+	if (CompiledRoot.Get() != InRoot)
+	{
+		CompileAccessors(InRoot);
+	}
+
+	return bCompiledAccessorsSupported;
+}
+
+bool FGameSettingDataSourceDynamic::CompileAccessors(UObject* InRoot) const
+{
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_FGameSettingDataSourceDynamic_CompileAccessors);
+
+	CompiledRoot = InRoot;
+	CompiledSegments.Reset();
+	bCompiledAccessorsSupported = false;
+
+	const UClass* ContainerClass = InRoot ? InRoot->GetClass() : nullptr;
+	for (int32 SegmentIndex = 0; SegmentIndex < SegmentNames.Num(); ++SegmentIndex)
+	{
+		if (!ContainerClass)
+		{
+			return false;
+		}
+
+		const bool bIsLastSegment = SegmentIndex == SegmentNames.Num() - 1;
+		FCompiledSegment& Segment = CompiledSegments.AddDefaulted_GetRef();
+
+		if (UFunction* Function = ContainerClass->FindFunctionByName(SegmentNames[SegmentIndex]))
+		{
+			FProperty* ReturnProperty = Function->GetReturnProperty();
+			if (bIsLastSegment)
+			{
+				// A getter returning the value, or a setter taking it.
+				const bool bIsGetter = ReturnProperty && Function->NumParms == 1;
+				const bool bIsSetter = !ReturnProperty && Function->NumParms == 1;
+				if (!bIsGetter && !bIsSetter)
+				{
+					return false;
+				}
+			}
+			else
+			{
+				// Anything along the way has to be an object we can keep following.
+				const FObjectProperty* ObjectProperty = CastField<FObjectProperty>(ReturnProperty);
+				if (!ObjectProperty || Function->NumParms != 1 || Function->ParmsSize != sizeof(UObject*))
+				{
+					return false;
+				}
+
+				ContainerClass = ObjectProperty->PropertyClass;
+			}
+
+			Segment.Function = Function;
+		}
+		else if (FProperty* Property = FindFProperty<FProperty>(ContainerClass, SegmentNames[SegmentIndex]))
+		{
+			// Static arrays need an index, leave those to the property path.
+			if (Property->ArrayDim != 1)
+			{
+				return false;
+			}
+
+			if (!bIsLastSegment)
+			{
+				const FObjectProperty* ObjectProperty = CastField<FObjectProperty>(Property);
+				if (!ObjectProperty)
+				{
+					return false;
+				}
+
+				ContainerClass = ObjectProperty->PropertyClass;
+			}
+
+			Segment.Property = Property;
+		}
+		else
+		{
+			return false;
+		}
+	}
+
+	bCompiledAccessorsSupported = CompiledSegments.Num() > 0;
+	return bCompiledAccessorsSupported;
+}
+
+UObject* FGameSettingDataSourceDynamic::GetLeafContainer(UObject* InRoot) const
+{
+	UObject* Container = InRoot;
+	for (int32 SegmentIndex = 0; Container && SegmentIndex < CompiledSegments.Num() - 1; ++SegmentIndex)
+	{
+		const FCompiledSegment& Segment = CompiledSegments[SegmentIndex];
+		if (Segment.Function)
+		{
+			Container = GameSettingDataSourceDynamic::CallObjectGetter(Container, Segment.Function);
+		}
+		else
+		{
+			Container = CastFieldChecked<FObjectProperty>(Segment.Property)->GetObjectPropertyValue_InContainer(Container);
+		}
+	}
+
+	return Container;
+}
+
+bool FGameSettingDataSourceDynamic::GetCompiledValueAsString(UObject* InRoot, FString& OutStringValue) const
+{
+	UObject* Container = GetLeafContainer(InRoot);
+	if (!Container)
+	{
+		return false;
+	}
+
+	const FCompiledSegment& Leaf = CompiledSegments.Last();
+	if (Leaf.Property)
+	{
+		Leaf.Property->ExportTextItem_InContainer(OutStringValue, Container, nullptr, Container, PPF_None);
+		return true;
+	}
+
+	FProperty* ReturnProperty = Leaf.Function->GetReturnProperty();
+	if (!ReturnProperty)
+	{
+		return false;
+	}
+
+	const GameSettingDataSourceDynamic::FFunctionParams Params(Leaf.Function);
+	Container->ProcessEvent(Leaf.Function, Params.Get());
+	ReturnProperty->ExportTextItem_InContainer(OutStringValue, Params.Get(), nullptr, nullptr, PPF_None);
+
+	return true;
+}
+
+bool FGameSettingDataSourceDynamic::SetCompiledValue(UObject* InRoot, const FString& InStringValue) const
+{
+	UObject* Container = GetLeafContainer(InRoot);
+	if (!Container)
+	{
+		return false;
+	}
+
+	const FCompiledSegment& Leaf = CompiledSegments.Last();
+	if (Leaf.Property)
+	{
+		return Leaf.Property->ImportText_InContainer(*InStringValue, Container, Container, PPF_None) != nullptr;
+	}
+
+	// Setters take the value as their only parameter.
+	FProperty* ValueProperty = Leaf.Function->GetReturnProperty() ? nullptr : CastField<FProperty>(Leaf.Function->ChildProperties);
+	if (!ValueProperty)
+	{
+		return false;
+	}
+
+	const GameSettingDataSourceDynamic::FFunctionParams Params(Leaf.Function);
+	if (!ValueProperty->ImportText_InContainer(*InStringValue, Params.Get(), nullptr, PPF_None))
+	{
+		return false;
+	}
+
+	Container->ProcessEvent(Leaf.Function, Params.Get());
+	return true;
+}
+
+template<typename ValueType>
+bool FGameSettingDataSourceDynamic::GetCompiledTypedValue(UObject* InRoot, ValueType& OutValue) const
+{
+	using FTypedAccess = GameSettingDataSourceDynamic::TTypedAccess<ValueType>;
+
+	if (!GameSettingDataSourceDynamic::bUseCompiledAccessors || !AreAccessorsCompiledFor(InRoot))
+	{
+		return false;
+	}
+
+	// Check the type before calling anything, so a mismatch doesn't call the getter twice.
+	const FCompiledSegment& Leaf = CompiledSegments.Last();
+	const FProperty* ValueProperty = Leaf.Property ? Leaf.Property : Leaf.Function->GetReturnProperty();
+	if (!ValueProperty || !FTypedAccess::Supports(ValueProperty))
+	{
+		return false;
+	}
+
+	UObject* Container = GetLeafContainer(InRoot);
+	if (!Container)
+	{
+		return false;
+	}
+
+	if (Leaf.Property)
+	{
+		OutValue = FTypedAccess::Read(ValueProperty, ValueProperty->ContainerPtrToValuePtr<void>(Container));
+		return true;
+	}
+
+	const GameSettingDataSourceDynamic::FFunctionParams Params(Leaf.Function);
+	Container->ProcessEvent(Leaf.Function, Params.Get());
+	OutValue = FTypedAccess::Read(ValueProperty, ValueProperty->ContainerPtrToValuePtr<void>(Params.Get()));
+
+	return true;
+}
+
+template<typename ValueType>
+bool FGameSettingDataSourceDynamic::SetCompiledTypedValue(UObject* InRoot, const ValueType& InValue) const
+{
+	using FTypedAccess = GameSettingDataSourceDynamic::TTypedAccess<ValueType>;
+
+	if (!GameSettingDataSourceDynamic::bUseCompiledAccessors || !AreAccessorsCompiledFor(InRoot))
+	{
+		return false;
+	}
+
+	const FCompiledSegment& Leaf = CompiledSegments.Last();
+	const FProperty* ValueProperty = Leaf.Property;
+	if (!ValueProperty && !Leaf.Function->GetReturnProperty())
+	{
+		// Setters take the value as their only parameter.
+		ValueProperty = CastField<FProperty>(Leaf.Function->ChildProperties);
+	}
+
+	if (!ValueProperty || !FTypedAccess::Supports(ValueProperty))
+	{
+		return false;
+	}
+
+	UObject* Container = GetLeafContainer(InRoot);
+	if (!Container)
+	{
+		return false;
+	}
+
+	if (Leaf.Property)
+	{
+		FTypedAccess::Write(ValueProperty, ValueProperty->ContainerPtrToValuePtr<void>(Container), InValue);
+		return true;
+	}
+
+	const GameSettingDataSourceDynamic::FFunctionParams Params(Leaf.Function);
+	FTypedAccess::Write(ValueProperty, ValueProperty->ContainerPtrToValuePtr<void>(Params.Get()), InValue);
+	Container->ProcessEvent(Leaf.Function, Params.Get());
+
+	return true;
+}
+
+bool FGameSettingDataSourceDynamic::TryGetValue(ULocalPlayer* InLocalPlayer, bool& OutValue) const
+{
+	return GetCompiledTypedValue(InLocalPlayer, OutValue);
+}
+
+bool FGameSettingDataSourceDynamic::TryGetValue(ULocalPlayer* InLocalPlayer, int64& OutValue) const
+{
+	return GetCompiledTypedValue(InLocalPlayer, OutValue);
+}
+
+bool FGameSettingDataSourceDynamic::TryGetValue(ULocalPlayer* InLocalPlayer, double& OutValue) const
+{
+	return GetCompiledTypedValue(InLocalPlayer, OutValue);
+}
+
+bool FGameSettingDataSourceDynamic::TryGetValue(ULocalPlayer* InLocalPlayer, FLinearColor& OutValue) const
+{
+	return GetCompiledTypedValue(InLocalPlayer, OutValue);
+}
+
+bool FGameSettingDataSourceDynamic::TryGetValue(ULocalPlayer* InLocalPlayer, FVector2D& OutValue) const
+{
+	return GetCompiledTypedValue(InLocalPlayer, OutValue);
+}
+
+bool FGameSettingDataSourceDynamic::TrySetValue(ULocalPlayer* InLocalPlayer, bool InValue)
+{
+	return SetCompiledTypedValue(InLocalPlayer, InValue);
+}
+
+bool FGameSettingDataSourceDynamic::TrySetValue(ULocalPlayer* InLocalPlayer, int64 InValue)
+{
+	return SetCompiledTypedValue(InLocalPlayer, InValue);
+}
+
+bool FGameSettingDataSourceDynamic::TrySetValue(ULocalPlayer* InLocalPlayer, double InValue)
+{
+	return SetCompiledTypedValue(InLocalPlayer, InValue);
+}
+
+bool FGameSettingDataSourceDynamic::TrySetValue(ULocalPlayer* InLocalPlayer, const FLinearColor& InValue)
+{
+	return SetCompiledTypedValue(InLocalPlayer, InValue);
+}
+
+bool FGameSettingDataSourceDynamic::TrySetValue(ULocalPlayer* InLocalPlayer, const FVector2D& InValue)
+{
+	return SetCompiledTypedValue(InLocalPlayer, InValue);
+}
+
+#if !UE_BUILD_SHIPPING
+void FGameSettingDataSourceDynamic::BenchmarkAccessors(int32 Iterations)
+{
+	int32 NumBenchmarked = 0;
+	int32 NumMismatched = 0;
+	double CompiledSeconds = 0.0;
+	double PropertyPathSeconds = 0.0;
+
+	for (const FGameSettingDataSourceDynamic* DataSource : GameSettingDataSourceDynamic::AllDataSources)
+	{
+		UObject* Root = DataSource->CompiledRoot.Get();
+		if (!Root || !DataSource->bCompiledAccessorsSupported || !DataSource->DynamicPath.IsResolved())
+		{
+			continue;
+		}
+
+		// Only getters can be read, setters would change the settings.
+		const FCompiledSegment& Leaf = DataSource->CompiledSegments.Last();
+		if (Leaf.Function && !Leaf.Function->GetReturnProperty())
+		{
+			continue;
+		}
+
+		FString CompiledValue;
+		double StartTime = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+		{
+			CompiledValue.Reset();
+			DataSource->GetCompiledValueAsString(Root, CompiledValue);
+		}
+		CompiledSeconds += FPlatformTime::Seconds() - StartTime;
+
+		FString PropertyPathValue;
+		StartTime = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+		{
+			PropertyPathValue.Reset();
+			PropertyPathHelpers::GetPropertyValueAsString(Root, DataSource->DynamicPath, PropertyPathValue);
+		}
+		PropertyPathSeconds += FPlatformTime::Seconds() - StartTime;
+
+		if (CompiledValue != PropertyPathValue)
+		{
+			NumMismatched++;
+			UE_LOG(LogConsoleResponse, Display, TEXT("  %s: compiled '%s', property path '%s'"), *DataSource->ToString(), *CompiledValue, *PropertyPathValue);
+		}
+
+		NumBenchmarked++;
+	}
+
+	const double NumReads = FMath::Max(1.0, (double)NumBenchmarked * Iterations);
+	UE_LOG(LogConsoleResponse, Display, TEXT("%d data sources, compiled %.3fus, property path %.3fus per read, %d mismatched"),
+		NumBenchmarked, CompiledSeconds * 1000000.0 / NumReads, PropertyPathSeconds * 1000000.0 / NumReads, NumMismatched);
+}
+
+static FAutoConsoleCommand CmdBenchmarkDataSources(
+	TEXT("GameSettings.BenchmarkDataSources"),
+	TEXT("Times reading every resolved dynamic data source through its compiled accessors and through its property path, and checks they agree.  Optionally pass the number of iterations."),
+	FConsoleCommandWithArgsDelegate::CreateStatic([](const TArray<FString>& Args)
+	{
+		int32 Iterations = 1000;
+		if (Args.Num() > 0)
+		{
+			LexFromString(Iterations, *Args[0]);
+		}
+
+		FGameSettingDataSourceDynamic::BenchmarkAccessors(FMath::Max(Iterations, 1));
+	}));
+#endif
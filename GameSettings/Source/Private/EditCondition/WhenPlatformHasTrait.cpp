@@ -58,6 +58,27 @@ TSharedRef<FWhenPlatformHasTrait> FWhenPlatformHasTrait::DisableIfPresent(FGamep
 	return Result;
 }
 
+void FWhenPlatformHasTrait::Initialize(const ULocalPlayer* InLocalPlayer)
+{
+	UCommonUIVisibilitySubsystem* VisibilitySubsystem = UCommonUIVisibilitySubsystem::Get(InLocalPlayer);
+	if (VisibilitySubsystem && BoundVisibilitySubsystem != VisibilitySubsystem)
+	{
+		if (UCommonUIVisibilitySubsystem* PreviousSubsystem = BoundVisibilitySubsystem.Get())
+		{
+			PreviousSubsystem->OnVisibilityTagsChanged.RemoveAll(this);
+		}
+
+		// Settings cache their edit state, so let them know when the traits change.
+		VisibilitySubsystem->OnVisibilityTagsChanged.AddSP(this, &FWhenPlatformHasTrait::HandleVisibilityTagsChanged);
+		BoundVisibilitySubsystem = VisibilitySubsystem;
+	}
+}
+
+void FWhenPlatformHasTrait::HandleVisibilityTagsChanged(UCommonUIVisibilitySubsystem* InVisibilitySubsystem)
+{
+	BroadcastEditConditionChanged();
+}
+
 void FWhenPlatformHasTrait::GatherEditState(const ULocalPlayer* InLocalPlayer, FGameSettingEditableState& InOutEditState) const
 {
 	if (UCommonUIVisibilitySubsystem::GetChecked(InLocalPlayer)->HasVisibilityTag(VisibilityTag) != bTagDesired)
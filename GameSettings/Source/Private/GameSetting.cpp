@@ -1,6 +1,8 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "GameSetting.h"
+#include "GameSettingProfiling.h"
+#include "GameSettingStartupScheduler.h"
 #include "Framework/Text/ITextDecorator.h"
 #include "Framework/Text/RichTextMarkupProcessing.h"
 #include "Engine/LocalPlayer.h"
@@ -10,6 +12,11 @@
 
 #define LOCTEXT_NAMESPACE "GameSetting"
 
+DECLARE_CYCLE_STAT(TEXT("Setting Initialize"), STAT_GameSetting_Initialize, STATGROUP_GameSettings);
+DECLARE_CYCLE_STAT(TEXT("Setting Apply"), STAT_GameSetting_Apply, STATGROUP_GameSettings);
+DECLARE_CYCLE_STAT(TEXT("Setting RefreshEditableState"), STAT_GameSetting_RefreshEditableState, STATGROUP_GameSettings);
+DECLARE_CYCLE_STAT(TEXT("Setting ComputeEditableState"), STAT_GameSetting_ComputeEditableState, STATGROUP_GameSettings);
+
 #define UE_CAN_SHOW_SETTINGS_DEBUG_INFO (!UE_BUILD_SHIPPING)
 
 namespace GameSettingsConsoleVars
@@ -31,6 +38,34 @@ namespace GameSettingsConsoleVars
 }
 
 
+namespace GameSettingEditableState
+{
+	/** Bumped by InvalidateAllEditableStates, and whenever any setting is applied. */
+	static uint32 GlobalEpoch = 1;
+
+	/** Bumped whenever the parts of any setting's edit state that filtering looks at change. */
+	static uint32 FilterableStateEpoch = 1;
+
+	static UGameSetting::FEditableStateCacheStats CacheStats;
+
+#if !UE_BUILD_SHIPPING
+	static FAutoConsoleCommand CmdDumpCacheStats(
+		TEXT("GameSettings.DumpEditableStateCacheStats"),
+		TEXT("Prints how often settings could reuse their cached edit state instead of gathering it again.  Pass 'reset' to clear the counters."),
+		FConsoleCommandWithArgsDelegate::CreateStatic([](const TArray<FString>& Args)
+		{
+			const uint64 Total = CacheStats.Hits + CacheStats.Misses;
+			UE_LOG(LogConsoleResponse, Display, TEXT("Editable state cache: %llu hits, %llu misses (%.1f%% hit rate)"),
+				CacheStats.Hits, CacheStats.Misses, Total > 0 ? 100.0 * CacheStats.Hits / Total : 0.0);
+
+			if (Args.Num() > 0 && Args[0] == TEXT("reset"))
+			{
+				CacheStats = UGameSetting::FEditableStateCacheStats();
+			}
+		}));
+#endif
+}
+
 //--------------------------------------
 // UGameSetting
 //--------------------------------------
@@ -43,7 +78,10 @@ void UGameSetting::Initialize(ULocalPlayer* InLocalPlayer)
 		return;
 	}
 
+	GAMESETTING_PROFILE_SCOPE(STAT_GameSetting_Initialize, this, Initialize);
+
 	LocalPlayer = InLocalPlayer;
+	ChangeEpoch++;
 
 	//TODO: GameSettings
 	//LocalPlayer->OnPlayerLoggedIn().AddUObject(this, &UGameSetting::RefreshEditableState, true);
@@ -64,7 +102,14 @@ void UGameSetting::Initialize(ULocalPlayer* InLocalPlayer)
 		Setting->Initialize(LocalPlayer);
 	}
 
-	Startup();
+	if (StartupProviders.Num() > 0)
+	{
+		FGameSettingStartupScheduler::StartupWhenProvidersReady(this);
+	}
+	else
+	{
+		Startup();
+	}
 }
 
 void UGameSetting::Startup()
@@ -72,6 +117,12 @@ void UGameSetting::Startup()
 	StartupComplete();
 }
 
+void UGameSetting::AddStartupProvider(const TSharedRef<FGameSettingStartupProvider>& InProvider)
+{
+	ensureMsgf(LocalPlayer == nullptr, TEXT("%s: startup providers must be added before the setting is initialized."), *DevName.ToString());
+	StartupProviders.Add(InProvider);
+}
+
 void UGameSetting::StartupComplete()
 {
 	ensureMsgf(!bReady, TEXT("StartupComplete called twice."));
@@ -80,11 +131,15 @@ void UGameSetting::StartupComplete()
 	{
 		bReady = true;
 		OnInitialized();
+
+		OnSettingReadyEvent.Broadcast(this);
 	}
 }
 
 void UGameSetting::Apply()
 {
+	GAMESETTING_PROFILE_SCOPE(STAT_GameSetting_Apply, this, Apply);
+
 	OnApply();
 
 	// Run through any edit conditions and let them know things changed.
@@ -94,12 +149,15 @@ void UGameSetting::Apply()
 	}
 
 	OnSettingAppliedEvent.Broadcast(this);
+
+	// Applying can change anything an edit condition looks at, e.g. the window mode or resolution.
+	InvalidateAllEditableStates();
 }
 
 void UGameSetting::OnInitialized()
 {
 	ensureMsgf(bReady, TEXT("OnInitialized called directly instead of via StartupComplete."));
-	EditableStateCache = ComputeEditableState();
+	UpdateEditableStateCache();
 }
 
 void UGameSetting::OnApply()
@@ -117,19 +175,57 @@ void UGameSetting::SetSettingParent(UGameSetting* InSettingParent)
 	SettingParent = InSettingParent;
 }
 
+void UGameSetting::CopyDefinitionFrom(const UGameSetting& InFreshSetting)
+{
+	DisplayName = InFreshSetting.DisplayName;
+	DisplayNameVisibility = InFreshSetting.DisplayNameVisibility;
+	DescriptionRichText = InFreshSetting.DescriptionRichText;
+	WarningRichText = InFreshSetting.WarningRichText;
+	Tags = InFreshSetting.Tags;
+	ApplyCategories = InFreshSetting.ApplyCategories;
+	DynamicDetails = InFreshSetting.DynamicDetails;
+	bReportAnalytics = InFreshSetting.bReportAnalytics;
+	bAdjustListViewPostRefresh = InFreshSetting.bAdjustListViewPostRefresh;
+
+	// The fresh setting already initialized its edit conditions for the same local player.
+	EditConditions = InFreshSetting.EditConditions;
+
+	InvalidateSearchableText();
+	InvalidateEditableState();
+}
+
+TConstArrayView<FName> UGameSetting::FindEffectiveApplyCategories() const
+{
+	for (const UGameSetting* Setting = this; Setting; Setting = Setting->GetSettingParent())
+	{
+		if (Setting->ApplyCategories.Num() > 0)
+		{
+			return Setting->ApplyCategories;
+		}
+	}
+
+	return TConstArrayView<FName>();
+}
+
 FGameSettingEditableState UGameSetting::ComputeEditableState() const
 {
+	GAMESETTING_PROFILE_SCOPE(STAT_GameSetting_ComputeEditableState, this, ComputeEditableState);
+
 	FGameSettingEditableState EditState;
+	EditState.OptionValues = GetEditStateOptionValues();
 
 	// Does this setting itself have any special rules?
 	OnGatherEditState(EditState);
 
-	// Run through any edit conditions
+	// Run through any edit conditions, shared conditions may already have been gathered this pass.
 	for (const TSharedRef<FGameSettingEditCondition>& EditCondition : EditConditions)
 	{
-		EditCondition->GatherEditState(LocalPlayer, EditState);
+		FGameSettingEditConditionCacheScope::GatherEditState(*EditCondition, LocalPlayer, EditState);
 	}
 
+	// The options may change after we're done, the disabled options are already resolved to indices.
+	EditState.OptionValues = TConstArrayView<FString>();
+
 	return EditState;
 }
 
@@ -144,13 +240,39 @@ const FString& UGameSetting::GetDescriptionPlainText() const
 	return AutoGenerated_DescriptionPlainText;
 }
 
-void UGameSetting::RefreshPlainText() const
+namespace GameSettingSearchableText
 {
-	//TODO: GameSettings
-	// TODO NDarnell Settings - Will need to recache if the language changes.
+	static uint32 Epoch = 1;
+
+	/** Bumped by InvalidateAllSearchableText, the module does so whenever the culture changes. */
+	static uint32 CultureEpoch = 1;
+}
+
+uint32 UGameSetting::GetSearchableTextEpoch()
+{
+	return GameSettingSearchableText::Epoch;
+}
 
-	if (bRefreshPlainSearchableText)
+void UGameSetting::InvalidateAllSearchableText()
+{
+	GameSettingSearchableText::CultureEpoch++;
+	GameSettingSearchableText::Epoch++;
+}
+
+void UGameSetting::InvalidateSearchableText()
+{
+	bRefreshPlainSearchableText = true;
+	SearchableTextVersion++;
+	GameSettingSearchableText::Epoch++;
+}
+
+void UGameSetting::RefreshPlainText() const
+{
+	// The description is localized, so the plain text is only valid for the culture it was generated in.
+	if (bRefreshPlainSearchableText || PlainTextCultureEpoch != GameSettingSearchableText::CultureEpoch)
 	{
+		QUICK_SCOPE_CYCLE_COUNTER(STAT_UGameSetting_RefreshPlainText);
+
 		TArray<FTextLineParseResults> ActualResultsArray;
 		FString ActualOutput;
 		FDefaultRichTextMarkupParser::GetStaticInstance()->Process(ActualResultsArray, DescriptionRichText.ToString(), ActualOutput);
@@ -172,11 +294,14 @@ void UGameSetting::RefreshPlainText() const
 		}
 
 		bRefreshPlainSearchableText = false;
+		PlainTextCultureEpoch = GameSettingSearchableText::CultureEpoch;
 	}
 }
 
 void UGameSetting::NotifySettingChanged(EGameSettingChangeReason Reason)
 {
+	ChangeEpoch++;
+
 	OnSettingChanged(Reason);
 	
 	// Run through any edit conditions and let them know things changed.
@@ -200,6 +325,7 @@ void UGameSetting::OnSettingChanged(EGameSettingChangeReason Reason)
 void UGameSetting::AddEditCondition(const TSharedRef<FGameSettingEditCondition>& InEditCondition)
 {
 	EditConditions.Add(InEditCondition);
+	ChangeEpoch++;
 
 	InEditCondition->OnEditConditionChangedEvent.AddUObject(this, &ThisClass::RefreshEditableState);
 }
@@ -208,11 +334,29 @@ void UGameSetting::AddEditDependency(UGameSetting* DependencySetting)
 {
 	if (ensure(DependencySetting))
 	{
+		EditDependencies.Add(DependencySetting);
+		ChangeEpoch++;
+
 		DependencySetting->OnSettingChangedEvent.AddUObject(this, &ThisClass::HandleEditDependencyChanged);
 		DependencySetting->OnSettingEditConditionChangedEvent.AddUObject(this, &ThisClass::HandleEditDependencyChanged);
 	}
 }
 
+void UGameSetting::ClearEditDependencies()
+{
+	for (UGameSetting* DependencySetting : EditDependencies)
+	{
+		if (DependencySetting)
+		{
+			DependencySetting->OnSettingChangedEvent.RemoveAll(this);
+			DependencySetting->OnSettingEditConditionChangedEvent.RemoveAll(this);
+		}
+	}
+
+	EditDependencies.Reset();
+	ChangeEpoch++;
+}
+
 void UGameSetting::RefreshEditableState(bool bNotifyEditConditionsChanged)
 {
 	// The LocalPlayer may be destroyed out from under us, if that happens,
@@ -231,9 +375,10 @@ void UGameSetting::RefreshEditableState(bool bNotifyEditConditionsChanged)
 
 	if (!bOnEditConditionsChangedEventGuard)
 	{
+		GAMESETTING_PROFILE_SCOPE(STAT_GameSetting_RefreshEditableState, this, RefreshEditableState);
 		TGuardValue<bool> Guard(bOnEditConditionsChangedEventGuard, true);
 	
-		EditableStateCache = ComputeEditableState();
+		UpdateEditableStateCache();
 
 		if (bNotifyEditConditionsChanged)
 		{
@@ -242,6 +387,91 @@ void UGameSetting::RefreshEditableState(bool bNotifyEditConditionsChanged)
 	}
 }
 
+void UGameSetting::RefreshEditableStateIfStale(bool bNotifyEditConditionsChanged)
+{
+	if (!LocalPlayer)
+	{
+		return;
+	}
+
+	if (LocalPlayer->IsPrimaryPlayer() == bEditableStateCacheForPrimaryPlayer && !HasVolatileEditConditions())
+	{
+		FEditableStateInputs Inputs;
+		GatherEditableStateInputs(Inputs);
+
+		if (Inputs == EditableStateCacheInputs)
+		{
+			GameSettingEditableState::CacheStats.Hits++;
+			return;
+		}
+	}
+
+	GameSettingEditableState::CacheStats.Misses++;
+	RefreshEditableState(bNotifyEditConditionsChanged);
+}
+
+void UGameSetting::InvalidateAllEditableStates()
+{
+	GameSettingEditableState::GlobalEpoch++;
+}
+
+uint32 UGameSetting::GetFilterableStateEpoch()
+{
+	return GameSettingEditableState::FilterableStateEpoch;
+}
+
+UGameSetting::FEditableStateCacheStats& UGameSetting::GetEditableStateCacheStats()
+{
+	return GameSettingEditableState::CacheStats;
+}
+
+void UGameSetting::GatherEditableStateInputs(FEditableStateInputs& OutInputs) const
+{
+	OutInputs.Reset();
+	OutInputs.Add(GameSettingEditableState::GlobalEpoch);
+	OutInputs.Add(ChangeEpoch);
+
+	for (const TSharedRef<FGameSettingEditCondition>& EditCondition : EditConditions)
+	{
+		OutInputs.Add(EditCondition->GetBroadcastCount());
+	}
+
+	for (const UGameSetting* DependencySetting : EditDependencies)
+	{
+		OutInputs.Add(DependencySetting ? DependencySetting->ChangeEpoch : 0);
+		OutInputs.Add(DependencySetting ? DependencySetting->EditStateEpoch : 0);
+	}
+}
+
+bool UGameSetting::HasVolatileEditConditions() const
+{
+	return EditConditions.ContainsByPredicate([](const TSharedRef<FGameSettingEditCondition>& EditCondition)
+	{
+		return EditCondition->IsVolatile();
+	});
+}
+
+void UGameSetting::UpdateEditableStateCache()
+{
+	FGameSettingEditableState NewEditableState = ComputeEditableState();
+	if (NewEditableState.IsVisible() != EditableStateCache.IsVisible() ||
+		NewEditableState.IsEnabled() != EditableStateCache.IsEnabled() ||
+		NewEditableState.IsResetable() != EditableStateCache.IsResetable())
+	{
+		GameSettingEditableState::FilterableStateEpoch++;
+	}
+
+	if (!NewEditableState.HasSameDisabledOptions(EditableStateCache))
+	{
+		DisabledOptionsEpoch++;
+	}
+
+	EditableStateCache = MoveTemp(NewEditableState);
+	GatherEditableStateInputs(EditableStateCacheInputs);
+	bEditableStateCacheForPrimaryPlayer = LocalPlayer && LocalPlayer->IsPrimaryPlayer();
+	EditStateEpoch++;
+}
+
 void UGameSetting::NotifyEditConditionsChanged()
 {
 	OnEditConditionsChanged();
@@ -254,14 +484,36 @@ void UGameSetting::OnEditConditionsChanged()
 
 }
 
+void UGameSetting::HandleEditDependenciesChanged(bool bNotifySettingChanged)
+{
+	OnDependencyChanged();
+	RefreshEditableStateIfStale();
+
+	if (bNotifySettingChanged)
+	{
+		NotifySettingChanged(EGameSettingChangeReason::DependencyChanged);
+	}
+}
+
 void UGameSetting::HandleEditDependencyChanged(UGameSetting* DependencySetting)
 {
+	// The registry re-evaluates everything depending on this change once it's over.
+	if (IsEditDependencyInRegistryGraph(DependencySetting))
+	{
+		return;
+	}
+
 	OnDependencyChanged();
 	RefreshEditableState();
 }
 
 void UGameSetting::HandleEditDependencyChanged(UGameSetting* DependencySetting, EGameSettingChangeReason Reason)
 {
+	if (IsEditDependencyInRegistryGraph(DependencySetting))
+	{
+		return;
+	}
+
 	OnDependencyChanged();
 	RefreshEditableState();
 
@@ -307,31 +559,5 @@ FText UGameSetting::GetDynamicDetailsInternal() const
 	return FText::GetEmpty();
 }
 
-UGameSetting::FStringCultureCache::FStringCultureCache(TFunction<FString()> InStringGetter)
-	: Culture(FInternationalization::Get().GetCurrentCulture())
-	, StringGetter(InStringGetter)
-{
-	StringCache = StringGetter();
-}
-
-void UGameSetting::FStringCultureCache::Invalidate()
-{
-	StringCache = StringGetter();
-	Culture = FInternationalization::Get().GetCurrentCulture();
-}
-
-FString UGameSetting::FStringCultureCache::Get() const
-{
-	if (Culture == FInternationalization::Get().GetCurrentCulture())
-	{
-		return StringCache;
-	}
-
-	StringCache = StringGetter();
-	Culture = FInternationalization::Get().GetCurrentCulture();
-
-	return StringCache;
-}
-
 #undef LOCTEXT_NAMESPACE
 
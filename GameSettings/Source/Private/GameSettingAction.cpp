@@ -50,5 +50,16 @@ void UGameSettingAction::ExecuteAction()
 	}
 }
 
+void UGameSettingAction::CopyDefinitionFrom(const UGameSetting& InFreshSetting)
+{
+	Super::CopyDefinitionFrom(InFreshSetting);
+
+	const UGameSettingAction& FreshSetting = CastChecked<UGameSettingAction>(InFreshSetting);
+	ActionText = FreshSetting.ActionText;
+	NamedAction = FreshSetting.NamedAction;
+	CustomAction = FreshSetting.CustomAction;
+	bDirtyAction = FreshSetting.bDirtyAction;
+}
+
 #undef LOCTEXT_NAMESPACE
 
@@ -1,6 +1,7 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "GameSettingCollection.h"
+#include "GameSettingRegistry.h"
 #include "Templates/Casts.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(GameSettingCollection)
@@ -30,6 +31,28 @@ void UGameSettingCollection::AddSetting(UGameSetting* Setting)
 	{
 		Setting->Initialize(LocalPlayer);
 	}
+
+	// We're already registered, so the registry has to know about the new setting too.
+	if (OwningRegistry)
+	{
+		OwningRegistry->RegisterAddedSetting(Setting);
+	}
+}
+
+void UGameSettingCollection::SetSettings(const TArray<UGameSetting*>& InSettings)
+{
+	Settings.Reset(InSettings.Num());
+
+	for (UGameSetting* Setting : InSettings)
+	{
+		Settings.Add(Setting);
+		Setting->SetSettingParent(this);
+
+		if (LocalPlayer)
+		{
+			Setting->Initialize(LocalPlayer);
+		}
+	}
 }
 
 TArray<UGameSettingCollection*> UGameSettingCollection::GetChildCollections() const
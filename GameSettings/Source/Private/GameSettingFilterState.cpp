@@ -10,11 +10,11 @@
 class FSettingFilterExpressionContext : public ITextFilterExpressionContext
 {
 public:
-	explicit FSettingFilterExpressionContext(const UGameSetting& InSetting) : Setting(InSetting) {}
+	explicit FSettingFilterExpressionContext(const FString& InSearchableText) : SearchableText(InSearchableText) {}
 
 	virtual bool TestBasicStringExpression(const FTextFilterString& InValue, const ETextFilterTextComparisonMode InTextComparisonMode) const override
 	{
-		return TextFilterUtils::TestBasicStringExpression(Setting.GetDescriptionPlainText(), InValue, InTextComparisonMode);
+		return TextFilterUtils::TestBasicStringExpression(SearchableText, InValue, InTextComparisonMode);
 	}
 
 	virtual bool TestComplexExpression(const FName& InKey, const FTextFilterString& InValue, const ETextFilterComparisonOperation InComparisonOperation, const ETextFilterTextComparisonMode InTextComparisonMode) const override
@@ -23,8 +23,8 @@ public:
 	}
 
 private:
-	/** Setting being filtered. */
-	const UGameSetting& Setting;
+	/** The searchable plain text of the setting being filtered. */
+	const FString& SearchableText;
 };
 
 //--------------------------------------
@@ -38,13 +38,24 @@ FGameSettingFilterState::FGameSettingFilterState()
 
 void FGameSettingFilterState::AddSettingToRootList(UGameSetting* InSetting)
 {
-	SettingAllowList.Add(InSetting);
-	SettingRootList.Add(InSetting);
+	AddSettingToAllowList(InSetting);
+
+	bool bAlreadyInRootList = false;
+	SettingRootSet.Add(InSetting, &bAlreadyInRootList);
+	if (!bAlreadyInRootList)
+	{
+		SettingRootList.Add(InSetting);
+	}
 }
 
 void FGameSettingFilterState::AddSettingToAllowList(UGameSetting* InSetting)
 {
-	SettingAllowList.Add(InSetting);
+	bool bAlreadyInAllowList = false;
+	SettingAllowSet.Add(InSetting, &bAlreadyInAllowList);
+	if (!bAlreadyInAllowList)
+	{
+		SettingAllowList.Add(InSetting);
+	}
 }
 
 void FGameSettingFilterState::SetSearchText(const FString& InSearchText)
@@ -52,7 +63,64 @@ void FGameSettingFilterState::SetSearchText(const FString& InSearchText)
 	SearchTextEvaluator.SetFilterText(FText::FromString(InSearchText));
 }
 
+bool FGameSettingFilterState::IsSameFilter(const FGameSettingFilterState& Other) const
+{
+	if (bIncludeDisabled != Other.bIncludeDisabled ||
+		bIncludeHidden != Other.bIncludeHidden ||
+		bIncludeResetable != Other.bIncludeResetable ||
+		bIncludeNestedPages != Other.bIncludeNestedPages)
+	{
+		return false;
+	}
+
+	if (SettingRootList != Other.SettingRootList || SettingAllowSet.Num() != Other.SettingAllowSet.Num())
+	{
+		return false;
+	}
+
+	for (const UGameSetting* AllowedSetting : SettingAllowSet)
+	{
+		if (!Other.SettingAllowSet.Contains(AllowedSetting))
+		{
+			return false;
+		}
+	}
+
+	return SearchTextEvaluator.GetFilterText().ToString().Equals(Other.SearchTextEvaluator.GetFilterText().ToString(), ESearchCase::CaseSensitive);
+}
+
+uint32 GetTypeHash(const FGameSettingFilterState& FilterState)
+{
+	uint32 Hash = GetTypeHash(FilterState.SearchTextEvaluator.GetFilterText().ToString());
+	Hash = HashCombineFast(Hash, (uint32)FilterState.bIncludeDisabled | ((uint32)FilterState.bIncludeHidden << 1) | ((uint32)FilterState.bIncludeResetable << 2) | ((uint32)FilterState.bIncludeNestedPages << 3));
+
+	for (const UGameSetting* RootSetting : FilterState.SettingRootList)
+	{
+		Hash = HashCombineFast(Hash, ::PointerHash(RootSetting));
+	}
+
+	// The allow set isn't ordered, so combine its settings in a way that doesn't depend on order.
+	uint32 AllowHash = 0;
+	for (const UGameSetting* AllowedSetting : FilterState.SettingAllowSet)
+	{
+		AllowHash ^= ::PointerHash(AllowedSetting);
+	}
+
+	return HashCombineFast(Hash, AllowHash);
+}
+
 bool FGameSettingFilterState::DoesSettingPassFilter(const UGameSetting& InSetting) const
+{
+	// Always search text last, it's generally the most expensive filter.
+	return DoesSettingPassFilterIgnoringText(InSetting) && DoesTextPassFilter(InSetting.GetDescriptionPlainText());
+}
+
+bool FGameSettingFilterState::DoesTextPassFilter(const FString& InSearchableText) const
+{
+	return SearchTextEvaluator.TestTextFilter(FSettingFilterExpressionContext(InSearchableText));
+}
+
+bool FGameSettingFilterState::DoesSettingPassFilterIgnoringText(const UGameSetting& InSetting) const
 {
 	const FGameSettingEditableState& EditableState = InSetting.GetEditState();
 
@@ -72,15 +140,15 @@ bool FGameSettingFilterState::DoesSettingPassFilter(const UGameSetting& InSettin
 	}
 
 	// Are we filtering settings?
-	if (SettingAllowList.Num() > 0)
+	if (SettingAllowSet.Num() > 0)
 	{
-		if (!SettingAllowList.Contains(&InSetting))
+		if (!SettingAllowSet.Contains(&InSetting))
 		{
 			bool bAllowed = false;
 			const UGameSetting* NextSetting = &InSetting;
 			while (const UGameSetting* Parent = NextSetting->GetSettingParent())
 			{
-				if (SettingAllowList.Contains(Parent))
+				if (SettingAllowSet.Contains(Parent))
 				{
 					bAllowed = true;
 					break;
@@ -98,8 +166,8 @@ bool FGameSettingFilterState::DoesSettingPassFilter(const UGameSetting& InSettin
 
 	// TODO more filters...
 
-	// Always search text last, it's generally the most expensive filter.
-	if (!SearchTextEvaluator.TestTextFilter(FSettingFilterExpressionContext(InSetting)))
+	// The search index already ruled out settings the search text can't match.
+	if (SearchCandidates && !SearchCandidates->Contains(&InSetting))
 	{
 		return false;
 	}
@@ -131,16 +199,28 @@ void FGameSettingEditableState::Disable(const FText& Reason)
 #endif
 
 	bEnabled = false;
+
 	DisabledReasons.Add(Reason);
 }
 
 void FGameSettingEditableState::DisableOption(const FString& Option)
 {
+	const int32 OptionIndex = OptionValues.IndexOfByKey(Option);
+	if (!ensureMsgf(OptionIndex != INDEX_NONE, TEXT("Can't disable option %s, it isn't one of the setting's options."), *Option))
+	{
+		return;
+	}
+
 #if !UE_BUILD_SHIPPING
-	ensureAlwaysMsgf(!DisabledOptions.Contains(Option), TEXT("You've already disabled this option."));
+	ensureAlwaysMsgf(!IsOptionDisabled(OptionIndex), TEXT("You've already disabled this option."));
 #endif
 
-	DisabledOptions.Add(Option);
+	if (DisabledOptions.Num() <= OptionIndex)
+	{
+		DisabledOptions.Add(false, OptionIndex + 1 - DisabledOptions.Num());
+	}
+
+	DisabledOptions[OptionIndex] = true;
 }
 
 void FGameSettingEditableState::UnableToReset()
@@ -148,5 +228,87 @@ void FGameSettingEditableState::UnableToReset()
 	bResetable = false;
 }
 
+void FGameSettingEditableState::Append(const FGameSettingEditableState& Other)
+{
+	bVisible &= Other.bVisible;
+	bEnabled &= Other.bEnabled;
+	bResetable &= Other.bResetable;
+	bHideFromAnalytics |= Other.bHideFromAnalytics;
+
+	if (Other.DisabledOptions.Num() > DisabledOptions.Num())
+	{
+		DisabledOptions.Add(false, Other.DisabledOptions.Num() - DisabledOptions.Num());
+	}
+	DisabledOptions.CombineWithBitwiseOR(Other.DisabledOptions, EBitwiseOperatorFlags::MaintainSize);
+
+	DisabledReasons.Append(Other.DisabledReasons);
+
+#if !UE_BUILD_SHIPPING
+	HiddenReasons.Append(Other.HiddenReasons);
+#endif
+}
+
+//--------------------------------------
+// FGameSettingEditConditionCacheScope
+//--------------------------------------
+
+FGameSettingEditConditionCacheScope* FGameSettingEditConditionCacheScope::ActiveScope = nullptr;
+
+FGameSettingEditConditionCacheScope::FGameSettingEditConditionCacheScope()
+{
+	check(IsInGameThread());
+
+	if (ActiveScope == nullptr)
+	{
+		ActiveScope = this;
+	}
+}
+
+FGameSettingEditConditionCacheScope::~FGameSettingEditConditionCacheScope()
+{
+	if (ActiveScope == this)
+	{
+		ActiveScope = nullptr;
+	}
+}
+
+void FGameSettingEditConditionCacheScope::GatherEditState(const FGameSettingEditCondition& InEditCondition, const ULocalPlayer* InLocalPlayer, FGameSettingEditableState& InOutEditState)
+{
+	if (ActiveScope == nullptr)
+	{
+		InEditCondition.GatherEditState(InLocalPlayer, InOutEditState);
+		return;
+	}
+
+	const TPair<const FGameSettingEditCondition*, const ULocalPlayer*> CacheKey(&InEditCondition, InLocalPlayer);
+	if (const FCachedResult* CachedResult = ActiveScope->CachedResults.Find(CacheKey))
+	{
+		if (CachedResult->BroadcastCount == InEditCondition.GetBroadcastCount())
+		{
+			InOutEditState.Append(CachedResult->EditState);
+			return;
+		}
+	}
+
+	FGameSettingEditableState ConditionEditState;
+	ConditionEditState.OptionValues = InOutEditState.OptionValues;
+	InEditCondition.GatherEditState(InLocalPlayer, ConditionEditState);
+	ConditionEditState.OptionValues = TConstArrayView<FString>();
+
+	InOutEditState.Append(ConditionEditState);
+
+	// Disabled options are indices into this setting's options, so they can't be shared with other settings.
+	if (ConditionEditState.HasDisabledOptions())
+	{
+		ActiveScope->CachedResults.Remove(CacheKey);
+	}
+	else
+	{
+		FCachedResult& CachedResult = ActiveScope->CachedResults.Add(CacheKey);
+		CachedResult.BroadcastCount = InEditCondition.GetBroadcastCount();
+		CachedResult.EditState = MoveTemp(ConditionEditState);
+	}
+}
+
 #undef LOCTEXT_NAMESPACE
 
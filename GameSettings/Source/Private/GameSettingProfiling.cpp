@@ -0,0 +1,89 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "GameSettingProfiling.h"
+
+#include "GameSetting.h"
+#include "HAL/IConsoleManager.h"
+
+#if UE_CAN_PROFILE_GAME_SETTINGS
+
+namespace GameSettingProfiling
+{
+	bool bProfileSettings = false;
+
+	static FAutoConsoleVariableRef CVarProfileSettings(
+		TEXT("GameSettings.ProfileSettings"),
+		bProfileSettings,
+		TEXT("Records call counts and time per setting DevName for initialize, apply, edit state and value access.\n")
+		TEXT("Use GameSettings.DumpSettingProfile to print them."),
+		ECVF_Default);
+
+	struct FSettingProfile
+	{
+		uint32 Calls[(int32)EOperation::Count] = {};
+		uint64 Cycles[(int32)EOperation::Count] = {};
+
+		uint64 GetTotalCycles() const
+		{
+			uint64 Total = 0;
+			for (const uint64 OperationCycles : Cycles)
+			{
+				Total += OperationCycles;
+			}
+			return Total;
+		}
+	};
+
+	static TMap<FName, FSettingProfile> SettingProfiles;
+
+	static const TCHAR* OperationNames[] =
+	{
+		TEXT("Initialize"),
+		TEXT("Apply"),
+		TEXT("RefreshEditableState"),
+		TEXT("ComputeEditableState"),
+		TEXT("GetValue"),
+		TEXT("SetValue"),
+	};
+	static_assert(UE_ARRAY_COUNT(OperationNames) == (int32)EOperation::Count, "Every operation needs a name.");
+
+	void RecordOperation(const UGameSetting* Setting, EOperation Operation, uint64 Cycles)
+	{
+		FSettingProfile& Profile = SettingProfiles.FindOrAdd(Setting->GetDevName());
+		Profile.Calls[(int32)Operation]++;
+		Profile.Cycles[(int32)Operation] += Cycles;
+	}
+
+	static FAutoConsoleCommand CmdDumpSettingProfile(
+		TEXT("GameSettings.DumpSettingProfile"),
+		TEXT("Prints the calls and time recorded per setting while GameSettings.ProfileSettings is enabled, slowest first.  Times are inclusive, so a collection's Initialize includes its children.  Pass 'reset' to clear them."),
+		FConsoleCommandWithArgsDelegate::CreateStatic([](const TArray<FString>& Args)
+		{
+			SettingProfiles.ValueSort([](const FSettingProfile& A, const FSettingProfile& B)
+			{
+				return A.GetTotalCycles() > B.GetTotalCycles();
+			});
+
+			UE_LOG(LogConsoleResponse, Display, TEXT("Game setting profile, %d settings:"), SettingProfiles.Num());
+			for (const TPair<FName, FSettingProfile>& Pair : SettingProfiles)
+			{
+				FString Line;
+				for (int32 OperationIndex = 0; OperationIndex < (int32)EOperation::Count; ++OperationIndex)
+				{
+					if (Pair.Value.Calls[OperationIndex] > 0)
+					{
+						Line += FString::Printf(TEXT("  %s %u (%.3fms)"), OperationNames[OperationIndex], Pair.Value.Calls[OperationIndex], FPlatformTime::ToMilliseconds64(Pair.Value.Cycles[OperationIndex]));
+					}
+				}
+
+				UE_LOG(LogConsoleResponse, Display, TEXT("  %s: %.3fms%s"), *Pair.Key.ToString(), FPlatformTime::ToMilliseconds64(Pair.Value.GetTotalCycles()), *Line);
+			}
+
+			if (Args.Num() > 0 && Args[0] == TEXT("reset"))
+			{
+				SettingProfiles.Reset();
+			}
+		}));
+}
+
+#endif
@@ -0,0 +1,71 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Stats/Stats.h"
+
+class UGameSetting;
+
+DECLARE_STATS_GROUP(TEXT("GameSettings"), STATGROUP_GameSettings, STATCAT_Advanced);
+
+#define UE_CAN_PROFILE_GAME_SETTINGS (!UE_BUILD_SHIPPING)
+
+namespace GameSettingProfiling
+{
+	/** The per setting operations tracked while GameSettings.ProfileSettings is enabled. */
+	enum class EOperation : uint8
+	{
+		Initialize,
+		Apply,
+		RefreshEditableState,
+		ComputeEditableState,
+		GetValue,
+		SetValue,
+
+		Count
+	};
+
+#if UE_CAN_PROFILE_GAME_SETTINGS
+	extern bool bProfileSettings;
+
+	void RecordOperation(const UGameSetting* Setting, EOperation Operation, uint64 Cycles);
+
+	/** Records the call and its inclusive time against the setting's DevName, see GameSettings.DumpSettingProfile. */
+	class FScope
+	{
+	public:
+		FScope(const UGameSetting* InSetting, EOperation InOperation)
+			: Setting(bProfileSettings ? InSetting : nullptr)
+			, Operation(InOperation)
+			, StartCycles(Setting ? FPlatformTime::Cycles64() : 0)
+		{
+		}
+
+		~FScope()
+		{
+			if (Setting)
+			{
+				RecordOperation(Setting, Operation, FPlatformTime::Cycles64() - StartCycles);
+			}
+		}
+
+	private:
+		const UGameSetting* Setting;
+		EOperation Operation;
+		uint64 StartCycles;
+	};
+#endif
+}
+
+/**
+ * Adds a stat/trace scope for the operation, and attributes it to the setting's DevName when per setting profiling
+ * is enabled.  The stat must have been declared with DECLARE_CYCLE_STAT in STATGROUP_GameSettings.
+ */
+#if UE_CAN_PROFILE_GAME_SETTINGS
+#define GAMESETTING_PROFILE_SCOPE(Stat, Setting, Operation) \
+	SCOPE_CYCLE_COUNTER(Stat); \
+	GameSettingProfiling::FScope ANONYMOUS_VARIABLE(GameSettingProfileScope)(Setting, GameSettingProfiling::EOperation::Operation)
+#else
+#define GAMESETTING_PROFILE_SCOPE(Stat, Setting, Operation) \
+	SCOPE_CYCLE_COUNTER(Stat)
+#endif
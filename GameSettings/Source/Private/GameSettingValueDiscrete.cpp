@@ -16,9 +16,21 @@ UGameSettingValueDiscrete::UGameSettingValueDiscrete()
 
 }
 
+TConstArrayView<FText> UGameSettingValueDiscrete::GetDiscreteOptionsView() const
+{
+	const uint32 OptionsVersion = GetDiscreteOptionsVersion();
+	if (!AreDiscreteOptionsVersioned() || CachedDiscreteOptionsVersion != OptionsVersion)
+	{
+		CachedDiscreteOptions = GetDiscreteOptions();
+		CachedDiscreteOptionsVersion = OptionsVersion;
+	}
+
+	return CachedDiscreteOptions;
+}
+
 FString UGameSettingValueDiscrete::GetAnalyticsValue() const
 {
-	const TArray<FText> Options = GetDiscreteOptions();
+	const TConstArrayView<FText> Options = GetDiscreteOptionsView();
 	const int32 CurrentOptionIndex = GetDiscreteOptionIndex();
 	if (Options.IsValidIndex(CurrentOptionIndex))
 	{
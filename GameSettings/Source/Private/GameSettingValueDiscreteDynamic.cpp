@@ -2,12 +2,17 @@
 
 #include "GameSettingValueDiscreteDynamic.h"
 #include "DataSource/GameSettingDataSource.h"
+#include "GameSettingProfiling.h"
+#include "HAL/IConsoleManager.h"
 #include "UObject/WeakObjectPtr.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(GameSettingValueDiscreteDynamic)
 
 #define LOCTEXT_NAMESPACE "GameSettingValueDiscreteDynamic"
 
+DECLARE_CYCLE_STAT(TEXT("DiscreteDynamic GetValue"), STAT_GameSettingValueDiscreteDynamic_GetValue, STATGROUP_GameSettings);
+DECLARE_CYCLE_STAT(TEXT("DiscreteDynamic SetValue"), STAT_GameSettingValueDiscreteDynamic_SetValue, STATGROUP_GameSettings);
+
 //////////////////////////////////////////////////////////////////////////
 // UGameSettingValueDiscreteDynamic
 //////////////////////////////////////////////////////////////////////////
@@ -16,6 +21,20 @@ UGameSettingValueDiscreteDynamic::UGameSettingValueDiscreteDynamic()
 {
 }
 
+void UGameSettingValueDiscreteDynamic::CopyDefinitionFrom(const UGameSetting& InFreshSetting)
+{
+	Super::CopyDefinitionFrom(InFreshSetting);
+
+	const UGameSettingValueDiscreteDynamic& FreshSetting = CastChecked<UGameSettingValueDiscreteDynamic>(InFreshSetting);
+	Getter = FreshSetting.Getter;
+	Setter = FreshSetting.Setter;
+	DefaultValue = FreshSetting.DefaultValue;
+	OptionValues = FreshSetting.OptionValues;
+	OptionDisplayTexts = FreshSetting.OptionDisplayTexts;
+	RebuildOptionValueIndices();
+	MarkDiscreteOptionsChanged();
+}
+
 void UGameSettingValueDiscreteDynamic::SetDynamicGetter(const TSharedRef<FGameSettingDataSource>& InGetter)
 {
 	Getter = InGetter;
@@ -34,20 +53,37 @@ void UGameSettingValueDiscreteDynamic::SetDefaultValueFromString(FString InOptio
 void UGameSettingValueDiscreteDynamic::AddDynamicOption(FString InOptionValue, FText InOptionText)
 {
 #if !UE_BUILD_SHIPPING
-	ensureAlwaysMsgf(!OptionValues.Contains(InOptionValue), TEXT("You already added this option InOptionValue: %s InOptionText %s."), *InOptionValue, *InOptionText.ToString());
+	ensureAlwaysMsgf(FindDynamicOptionIndex(InOptionValue) == INDEX_NONE, TEXT("You already added this option InOptionValue: %s InOptionText %s."), *InOptionValue, *InOptionText.ToString());
 #endif
 
-	OptionValues.Add(InOptionValue);
+	const int32 Index = OptionValues.Add(InOptionValue);
 	OptionDisplayTexts.Add(InOptionText);
+	OptionValueIndices.FindOrAdd(InOptionValue, Index);
+	MarkDiscreteOptionsChanged();
+
+	// Disabled options are stored by index, so they need resolving again.
+	if (IsReady())
+	{
+		RefreshEditableState(false);
+	}
 }
 
 void UGameSettingValueDiscreteDynamic::RemoveDynamicOption(FString InOptionValue)
 {
-	const int32 Index = OptionValues.IndexOfByKey(InOptionValue);
+	const int32 Index = FindDynamicOptionIndex(InOptionValue);
 	if (Index != INDEX_NONE)
 	{
 		OptionValues.RemoveAt(Index);
 		OptionDisplayTexts.RemoveAt(Index);
+
+		// Everything after the removed option moved down one.
+		RebuildOptionValueIndices();
+		MarkDiscreteOptionsChanged();
+
+		if (IsReady())
+		{
+			RefreshEditableState(false);
+		}
 	}
 }
 
@@ -58,11 +94,53 @@ const TArray<FString>& UGameSettingValueDiscreteDynamic::GetDynamicOptions()
 
 bool UGameSettingValueDiscreteDynamic::HasDynamicOption(const FString& InOptionValue)
 {
-	return OptionValues.Contains(InOptionValue);
+	return FindDynamicOptionIndex(InOptionValue) != INDEX_NONE;
+}
+
+int32 UGameSettingValueDiscreteDynamic::FindDynamicOptionIndex(const FString& InOptionValue) const
+{
+	// Subclasses used to edit OptionValues directly, so catch the map falling behind rather than trusting it.
+	if (OptionValueIndices.Num() != OptionValues.Num())
+	{
+		RebuildOptionValueIndices();
+	}
+
+	const int32 Index = OptionValueIndices.FindRef(InOptionValue, INDEX_NONE);
+	if (Index != INDEX_NONE && !(OptionValues.IsValidIndex(Index) && AreOptionsEqual(OptionValues[Index], InOptionValue)))
+	{
+		RebuildOptionValueIndices();
+		return OptionValueIndices.FindRef(InOptionValue, INDEX_NONE);
+	}
+
+	return Index;
+}
+
+void UGameSettingValueDiscreteDynamic::ResetDynamicOptions(int32 NewSize)
+{
+	OptionValues.Reset(NewSize);
+	OptionDisplayTexts.Reset(NewSize);
+	OptionValueIndices.Reset();
+	MarkDiscreteOptionsChanged();
+}
+
+void UGameSettingValueDiscreteDynamic::RebuildOptionValueIndices() const
+{
+	OptionValueIndices.Reset();
+	OptionValueIndices.Reserve(OptionValues.Num());
+
+	for (int32 OptionIndex = 0; OptionIndex < OptionValues.Num(); ++OptionIndex)
+	{
+		// Keep the first of any duplicates, which is what a linear search would find.
+		if (!OptionValueIndices.Contains(OptionValues[OptionIndex]))
+		{
+			OptionValueIndices.Add(OptionValues[OptionIndex], OptionIndex);
+		}
+	}
 }
 
 FString UGameSettingValueDiscreteDynamic::GetValueAsString() const
 {
+	GAMESETTING_PROFILE_SCOPE(STAT_GameSettingValueDiscreteDynamic_GetValue, this, GetValue);
 	return Getter->GetValueAsString(LocalPlayer);
 }
 
@@ -74,11 +152,49 @@ void UGameSettingValueDiscreteDynamic::SetValueFromString(FString InStringValue)
 void UGameSettingValueDiscreteDynamic::SetValueFromString(FString InStringValue, EGameSettingChangeReason Reason)
 {
 	check(Setter);
-	Setter->SetValue(LocalPlayer, InStringValue);
+	{
+		GAMESETTING_PROFILE_SCOPE(STAT_GameSettingValueDiscreteDynamic_SetValue, this, SetValue);
+		Setter->SetValue(LocalPlayer, InStringValue);
+	}
 
 	NotifySettingChanged(Reason);
 }
 
+template<typename ValueType>
+bool UGameSettingValueDiscreteDynamic::TryGetTypedValueImpl(ValueType& OutValue) const
+{
+	GAMESETTING_PROFILE_SCOPE(STAT_GameSettingValueDiscreteDynamic_GetValue, this, GetValue);
+	return Getter->TryGetValue(LocalPlayer, OutValue);
+}
+
+template<typename ValueType>
+bool UGameSettingValueDiscreteDynamic::TrySetTypedValueImpl(const ValueType& InValue)
+{
+	check(Setter);
+	{
+		GAMESETTING_PROFILE_SCOPE(STAT_GameSettingValueDiscreteDynamic_SetValue, this, SetValue);
+		if (!Setter->TrySetValue(LocalPlayer, InValue))
+		{
+			return false;
+		}
+	}
+
+	NotifySettingChanged(EGameSettingChangeReason::Change);
+	return true;
+}
+
+bool UGameSettingValueDiscreteDynamic::TryGetTypedValue(bool& OutValue) const { return TryGetTypedValueImpl(OutValue); }
+bool UGameSettingValueDiscreteDynamic::TryGetTypedValue(int64& OutValue) const { return TryGetTypedValueImpl(OutValue); }
+bool UGameSettingValueDiscreteDynamic::TryGetTypedValue(double& OutValue) const { return TryGetTypedValueImpl(OutValue); }
+bool UGameSettingValueDiscreteDynamic::TryGetTypedValue(FLinearColor& OutValue) const { return TryGetTypedValueImpl(OutValue); }
+bool UGameSettingValueDiscreteDynamic::TryGetTypedValue(FVector2D& OutValue) const { return TryGetTypedValueImpl(OutValue); }
+
+bool UGameSettingValueDiscreteDynamic::TrySetTypedValue(bool InValue) { return TrySetTypedValueImpl(InValue); }
+bool UGameSettingValueDiscreteDynamic::TrySetTypedValue(int64 InValue) { return TrySetTypedValueImpl(InValue); }
+bool UGameSettingValueDiscreteDynamic::TrySetTypedValue(double InValue) { return TrySetTypedValueImpl(InValue); }
+bool UGameSettingValueDiscreteDynamic::TrySetTypedValue(const FLinearColor& InValue) { return TrySetTypedValueImpl(InValue); }
+bool UGameSettingValueDiscreteDynamic::TrySetTypedValue(const FVector2D& InValue) { return TrySetTypedValueImpl(InValue); }
+
 bool UGameSettingValueDiscreteDynamic::AreOptionsEqual(const FString& InOptionA, const FString& InOptionB) const
 {
 	return InOptionA == InOptionB;
@@ -136,10 +252,11 @@ void UGameSettingValueDiscreteDynamic::SetDiscreteOptionByIndex(int32 Index)
 
 int32 UGameSettingValueDiscreteDynamic::GetDiscreteOptionIndex() const
 {
-	const FString CurrentValue = GetValueAsString();
-	const int32 Index = OptionValues.IndexOfByPredicate([this, CurrentValue](const FString& InOption) {
-		return AreOptionsEqual(CurrentValue, InOption);
-	});
+	int32 Index = INDEX_NONE;
+	if (!TryGetTypedOptionIndex(Index))
+	{
+		Index = FindDynamicOptionIndex(GetValueAsString());
+	}
 
 	// If we can't find the correct index, send the default index.
 	if (Index == INDEX_NONE)
@@ -154,9 +271,7 @@ int32 UGameSettingValueDiscreteDynamic::GetDiscreteOptionDefaultIndex() const
 {
 	if (DefaultValue.IsSet())
 	{
-		return OptionValues.IndexOfByPredicate([this](const FString& InOption) {
-			return AreOptionsEqual(DefaultValue.GetValue(), InOption);
-		});
+		return FindDynamicOptionIndex(DefaultValue.GetValue());
 	}
 
 	return INDEX_NONE;
@@ -164,15 +279,15 @@ int32 UGameSettingValueDiscreteDynamic::GetDiscreteOptionDefaultIndex() const
 
 TArray<FText> UGameSettingValueDiscreteDynamic::GetDiscreteOptions() const
 {
-	const TArray<FString>& DisabledOptions = GetEditState().GetDisabledOptions();
+	const FGameSettingEditableState& EditState = GetEditState();
 
-	if (DisabledOptions.Num() > 0)
+	if (EditState.HasDisabledOptions())
 	{
 		TArray<FText> AllowedOptions;
 
 		for (int32 OptionIndex = 0; OptionIndex < OptionValues.Num(); ++OptionIndex)
 		{
-			if (!DisabledOptions.Contains(OptionValues[OptionIndex]))
+			if (!EditState.IsOptionDisabled(OptionIndex))
 			{
 				AllowedOptions.Add(OptionDisplayTexts[OptionIndex]);
 			}
@@ -184,6 +299,87 @@ TArray<FText> UGameSettingValueDiscreteDynamic::GetDiscreteOptions() const
 	return OptionDisplayTexts;
 }
 
+TConstArrayView<FText> UGameSettingValueDiscreteDynamic::GetDiscreteOptionsView() const
+{
+	// Disabled options are filtered out, which needs a copy.
+	if (GetEditState().HasDisabledOptions())
+	{
+		return Super::GetDiscreteOptionsView();
+	}
+
+	return OptionDisplayTexts;
+}
+
+#if !UE_BUILD_SHIPPING
+void UGameSettingValueDiscreteDynamic::BenchmarkOptionLookup(int32 NumOptions, int32 Iterations)
+{
+	UGameSettingValueDiscreteDynamic* Setting = NewObject<UGameSettingValueDiscreteDynamic>(GetTransientPackage());
+	for (int32 OptionIndex = 0; OptionIndex < NumOptions; ++OptionIndex)
+	{
+		Setting->AddDynamicOption(FString::Printf(TEXT("Option_%d"), OptionIndex), FText::AsNumber(OptionIndex));
+	}
+
+	int32 NumMismatched = 0;
+	int64 HashedChecksum = 0;
+	double StartTime = FPlatformTime::Seconds();
+	for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+	{
+		for (const FString& OptionValue : Setting->OptionValues)
+		{
+			HashedChecksum += Setting->FindDynamicOptionIndex(OptionValue);
+		}
+	}
+	const double HashedSeconds = FPlatformTime::Seconds() - StartTime;
+
+	int64 LinearChecksum = 0;
+	StartTime = FPlatformTime::Seconds();
+	for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+	{
+		for (const FString& OptionValue : Setting->OptionValues)
+		{
+			LinearChecksum += Setting->OptionValues.IndexOfByPredicate([Setting, &OptionValue](const FString& InOption) {
+				return Setting->AreOptionsEqual(OptionValue, InOption);
+			});
+		}
+	}
+	const double LinearSeconds = FPlatformTime::Seconds() - StartTime;
+
+	for (int32 OptionIndex = 0; OptionIndex < NumOptions; ++OptionIndex)
+	{
+		if (Setting->FindDynamicOptionIndex(Setting->OptionValues[OptionIndex]) != OptionIndex)
+		{
+			NumMismatched++;
+		}
+	}
+
+	Setting->MarkAsGarbage();
+
+	const double NumLookups = FMath::Max(1.0, (double)NumOptions * Iterations);
+	UE_LOG(LogConsoleResponse, Display, TEXT("%d options, hashed %.3fus, linear %.3fus per lookup, %d mismatched%s"),
+		NumOptions, HashedSeconds * 1000000.0 / NumLookups, LinearSeconds * 1000000.0 / NumLookups, NumMismatched,
+		HashedChecksum == LinearChecksum ? TEXT("") : TEXT(", checksums differ"));
+}
+
+static FAutoConsoleCommand CmdBenchmarkDiscreteOptions(
+	TEXT("GameSettings.BenchmarkDiscreteOptions"),
+	TEXT("Times looking up every option of a discrete setting, hashed and by linear search.  Optionally pass the number of options (default 200) and iterations."),
+	FConsoleCommandWithArgsDelegate::CreateStatic([](const TArray<FString>& Args)
+	{
+		int32 NumOptions = 200;
+		int32 Iterations = 1000;
+		if (Args.Num() > 0)
+		{
+			LexFromString(NumOptions, *Args[0]);
+		}
+		if (Args.Num() > 1)
+		{
+			LexFromString(Iterations, *Args[1]);
+		}
+
+		UGameSettingValueDiscreteDynamic::BenchmarkOptionLookup(FMath::Max(NumOptions, 1), FMath::Max(Iterations, 1));
+	}));
+#endif
+
 //////////////////////////////////////////////////////////////////////////
 // UGameSettingValueDiscreteDynamic_Bool
 //////////////////////////////////////////////////////////////////////////
@@ -213,6 +409,41 @@ void UGameSettingValueDiscreteDynamic_Bool::SetDefaultValue(bool Value)
 	DefaultValue = LexToString(Value);
 }
 
+bool UGameSettingValueDiscreteDynamic_Bool::GetValue() const
+{
+	bool TypedValue;
+	if (TryGetTypedValue(TypedValue))
+	{
+		return TypedValue;
+	}
+
+	bool Value = false;
+	LexFromString(Value, *GetValueAsString());
+	return Value;
+}
+
+void UGameSettingValueDiscreteDynamic_Bool::SetValue(bool InValue)
+{
+	if (!TrySetTypedValue(InValue))
+	{
+		SetValueFromString(LexToString(InValue));
+	}
+}
+
+bool UGameSettingValueDiscreteDynamic_Bool::TryGetTypedOptionIndex(int32& OutIndex) const
+{
+	bool TypedValue;
+	if (!TryGetTypedValue(TypedValue))
+	{
+		return false;
+	}
+
+	OutIndex = FindParsedOptionIndex(ParsedOptionValues,
+		[](const FString& InOptionValue) { bool bOptionValue = false; LexFromString(bOptionValue, *InOptionValue); return bOptionValue; },
+		[TypedValue](bool bOptionValue) { return bOptionValue == TypedValue; });
+	return true;
+}
+
 //////////////////////////////////////////////////////////////////////////
 // UGameSettingValueDiscreteDynamic_Number
 //////////////////////////////////////////////////////////////////////////
@@ -229,6 +460,27 @@ void UGameSettingValueDiscreteDynamic_Number::OnInitialized()
 	ensure(OptionValues.Num() > 0);
 }
 
+bool UGameSettingValueDiscreteDynamic_Number::TryGetTypedOptionIndex(int32& OutIndex) const
+{
+	double TypedValue;
+	int64 IntegerValue;
+	if (TryGetTypedValue(IntegerValue))
+	{
+		TypedValue = (double)IntegerValue;
+	}
+	else if (!TryGetTypedValue(TypedValue))
+	{
+		return false;
+	}
+
+	// Options are written with LexToString, which doesn't round trip floating point values exactly.
+	const double Tolerance = UE_KINDA_SMALL_NUMBER * FMath::Max(1.0, FMath::Abs(TypedValue));
+	OutIndex = FindParsedOptionIndex(ParsedOptionValues,
+		[](const FString& InOptionValue) { double OptionValue = 0.0; LexFromString(OptionValue, *InOptionValue); return OptionValue; },
+		[TypedValue, Tolerance](double OptionValue) { return FMath::IsNearlyEqual(OptionValue, TypedValue, Tolerance); });
+	return true;
+}
+
 //////////////////////////////////////////////////////////////////////////
 // UGameSettingValueDiscreteDynamic_Enum
 //////////////////////////////////////////////////////////////////////////
@@ -245,6 +497,21 @@ void UGameSettingValueDiscreteDynamic_Enum::OnInitialized()
 	ensure(OptionValues.Num() > 0);
 }
 
+bool UGameSettingValueDiscreteDynamic_Enum::TryGetTypedOptionIndex(int32& OutIndex) const
+{
+	// Options added without AddEnumOption can only be matched by name.
+	int64 TypedValue;
+	if (!OptionsEnum || !TryGetTypedValue(TypedValue))
+	{
+		return false;
+	}
+
+	OutIndex = FindParsedOptionIndex(ParsedOptionValues,
+		[this](const FString& InOptionValue) { return OptionsEnum->GetValueByNameString(InOptionValue); },
+		[TypedValue](int64 OptionValue) { return OptionValue == TypedValue; });
+	return true;
+}
+
 //////////////////////////////////////////////////////////////////////////
 // UGameSettingValueDiscreteDynamic_Color
 //////////////////////////////////////////////////////////////////////////
@@ -254,5 +521,38 @@ UGameSettingValueDiscreteDynamic_Color::UGameSettingValueDiscreteDynamic_Color()
 
 }
 
+bool UGameSettingValueDiscreteDynamic_Color::TryGetTypedOptionIndex(int32& OutIndex) const
+{
+	FLinearColor TypedValue;
+	if (!TryGetTypedValue(TypedValue))
+	{
+		return false;
+	}
+
+	OutIndex = FindParsedOptionIndex(ParsedOptionValues,
+		[](const FString& InOptionValue) { FLinearColor OptionValue; OptionValue.InitFromString(InOptionValue); return OptionValue; },
+		[&TypedValue](const FLinearColor& OptionValue) { return OptionValue.Equals(TypedValue, UE_KINDA_SMALL_NUMBER); });
+	return true;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// UGameSettingValueDiscreteDynamic_Vector2D
+//////////////////////////////////////////////////////////////////////////
+
+bool UGameSettingValueDiscreteDynamic_Vector2D::TryGetTypedOptionIndex(int32& OutIndex) const
+{
+	FVector2D TypedValue;
+	if (!TryGetTypedValue(TypedValue))
+	{
+		return false;
+	}
+
+	// FVector2D::ToString only writes three decimals.
+	OutIndex = FindParsedOptionIndex(ParsedOptionValues,
+		[](const FString& InOptionValue) { FVector2D OptionValue = FVector2D::ZeroVector; OptionValue.InitFromString(InOptionValue); return OptionValue; },
+		[&TypedValue](const FVector2D& OptionValue) { return OptionValue.Equals(TypedValue, 0.001); });
+	return true;
+}
+
 
 #undef LOCTEXT_NAMESPACE
@@ -3,12 +3,16 @@
 #include "GameSettingValueScalarDynamic.h"
 
 #include "DataSource/GameSettingDataSource.h"
+#include "GameSettingProfiling.h"
 #include "UObject/WeakObjectPtr.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(GameSettingValueScalarDynamic)
 
 #define LOCTEXT_NAMESPACE "GameSetting"
 
+DECLARE_CYCLE_STAT(TEXT("ScalarDynamic GetValue"), STAT_GameSettingValueScalarDynamic_GetValue, STATGROUP_GameSettings);
+DECLARE_CYCLE_STAT(TEXT("ScalarDynamic SetValue"), STAT_GameSettingValueScalarDynamic_SetValue, STATGROUP_GameSettings);
+
 //////////////////////////////////////////////////////////////////////////
 // SettingScalarFormats
 //////////////////////////////////////////////////////////////////////////
@@ -123,6 +127,21 @@ void UGameSettingValueScalarDynamic::RestoreToInitial()
 	SetValue(InitialValue, EGameSettingChangeReason::RestoreToInitial);
 }
 
+void UGameSettingValueScalarDynamic::CopyDefinitionFrom(const UGameSetting& InFreshSetting)
+{
+	Super::CopyDefinitionFrom(InFreshSetting);
+
+	const UGameSettingValueScalarDynamic& FreshSetting = CastChecked<UGameSettingValueScalarDynamic>(InFreshSetting);
+	Getter = FreshSetting.Getter;
+	Setter = FreshSetting.Setter;
+	DefaultValue = FreshSetting.DefaultValue;
+	SourceRange = FreshSetting.SourceRange;
+	SourceStep = FreshSetting.SourceStep;
+	Minimum = FreshSetting.Minimum;
+	Maximum = FreshSetting.Maximum;
+	DisplayFormat = FreshSetting.DisplayFormat;
+}
+
 void UGameSettingValueScalarDynamic::SetDynamicGetter(const TSharedRef<FGameSettingDataSource>& InGetter)
 {
 	Getter = InGetter;
@@ -161,9 +180,15 @@ void UGameSettingValueScalarDynamic::SetMaximumLimit(const TOptional<double>& In
 
 double UGameSettingValueScalarDynamic::GetValue() const
 {
-	const FString OutValue = Getter->GetValueAsString(LocalPlayer);
+	GAMESETTING_PROFILE_SCOPE(STAT_GameSettingValueScalarDynamic_GetValue, this, GetValue);
 
 	double Value;
+	if (Getter->TryGetValue(LocalPlayer, Value))
+	{
+		return Value;
+	}
+
+	const FString OutValue = Getter->GetValueAsString(LocalPlayer);
 	LexFromString(Value, *OutValue);
 
 	return Value;
@@ -199,8 +224,13 @@ void UGameSettingValueScalarDynamic::SetValue(double InValue, EGameSettingChange
 		InValue = FMath::Min(Maximum.GetValue(), InValue);
 	}
 
-	const FString StringValue = LexToString(InValue);
-	Setter->SetValue(LocalPlayer, StringValue);
+	{
+		GAMESETTING_PROFILE_SCOPE(STAT_GameSettingValueScalarDynamic_SetValue, this, SetValue);
+		if (!Setter->TrySetValue(LocalPlayer, InValue))
+		{
+			Setter->SetValue(LocalPlayer, LexToString(InValue));
+		}
+	}
 
 	NotifySettingChanged(Reason);
 }
@@ -1,5 +1,7 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
+#include "GameSetting.h"
+#include "Internationalization/Internationalization.h"
 #include "Modules/ModuleManager.h"
 
 /**
@@ -13,7 +15,7 @@ public:
 	virtual void ShutdownModule() override;
 
 private:
-
+	FDelegateHandle CultureChangedHandle;
 };
 
 
@@ -23,10 +25,16 @@ FGameSettingsModule::FGameSettingsModule()
 
 void FGameSettingsModule::StartupModule()
 {
+	// Setting descriptions are localized, so their searchable plain text changes with the culture.
+	CultureChangedHandle = FInternationalization::Get().OnCultureChanged().AddStatic(&UGameSetting::InvalidateAllSearchableText);
 }
 
 void FGameSettingsModule::ShutdownModule()
 {
+	if (FInternationalization::IsAvailable())
+	{
+		FInternationalization::Get().OnCultureChanged().Remove(CultureChangedHandle);
+	}
 }
 
 IMPLEMENT_MODULE(FGameSettingsModule, GameSettings);
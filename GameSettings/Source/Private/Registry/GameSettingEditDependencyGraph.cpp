@@ -0,0 +1,183 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "GameSettingEditDependencyGraph.h"
+
+#include "Containers/BitArray.h"
+#include "GameSetting.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogGameSettings, Log, All);
+
+//--------------------------------------
+// FGameSettingEditDependencyGraph
+//--------------------------------------
+
+void FGameSettingEditDependencyGraph::Reset()
+{
+	Nodes.Reset();
+	NodeIndices.Reset();
+}
+
+int32 FGameSettingEditDependencyGraph::FindOrAddNode(UGameSetting* InSetting)
+{
+	if (const int32* ExistingIndex = NodeIndices.Find(InSetting))
+	{
+		return *ExistingIndex;
+	}
+
+	const int32 NodeIndex = Nodes.AddDefaulted();
+	Nodes[NodeIndex].Setting = InSetting;
+	NodeIndices.Add(InSetting, NodeIndex);
+
+	return NodeIndex;
+}
+
+void FGameSettingEditDependencyGraph::Compile(TConstArrayView<TObjectPtr<UGameSetting>> InSettings)
+{
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_FGameSettingEditDependencyGraph_Compile);
+
+	Reset();
+
+	for (UGameSetting* Setting : InSettings)
+	{
+		for (UGameSetting* DependencySetting : Setting->GetEditDependencies())
+		{
+			if (DependencySetting)
+			{
+				const int32 DependentIndex = FindOrAddNode(Setting);
+				const int32 DependencyIndex = FindOrAddNode(DependencySetting);
+				Nodes[DependencyIndex].Dependents.AddUnique(DependentIndex);
+			}
+		}
+	}
+
+	// Tarjan's strongly connected components.  Each component is a cycle (or a single setting), and they're found
+	// dependents first, so reversing the order they're found in gives the order to evaluate them in.
+	struct FVisitState
+	{
+		int32 Index = INDEX_NONE;
+		int32 LowLink = INDEX_NONE;
+		bool bOnStack = false;
+	};
+
+	TArray<FVisitState> VisitStates;
+	VisitStates.SetNum(Nodes.Num());
+
+	TArray<int32> Stack;
+	TArray<TArray<int32>> Components;
+	int32 NextIndex = 0;
+
+	TFunction<void(int32)> Visit = [&](int32 NodeIndex)
+	{
+		FVisitState& State = VisitStates[NodeIndex];
+		State.Index = State.LowLink = NextIndex++;
+		State.bOnStack = true;
+		Stack.Push(NodeIndex);
+
+		for (const int32 DependentIndex : Nodes[NodeIndex].Dependents)
+		{
+			if (VisitStates[DependentIndex].Index == INDEX_NONE)
+			{
+				Visit(DependentIndex);
+				VisitStates[NodeIndex].LowLink = FMath::Min(VisitStates[NodeIndex].LowLink, VisitStates[DependentIndex].LowLink);
+			}
+			else if (VisitStates[DependentIndex].bOnStack)
+			{
+				VisitStates[NodeIndex].LowLink = FMath::Min(VisitStates[NodeIndex].LowLink, VisitStates[DependentIndex].Index);
+			}
+		}
+
+		if (VisitStates[NodeIndex].LowLink == VisitStates[NodeIndex].Index)
+		{
+			TArray<int32>& Component = Components.AddDefaulted_GetRef();
+			int32 ComponentNodeIndex;
+			do
+			{
+				ComponentNodeIndex = Stack.Pop();
+				VisitStates[ComponentNodeIndex].bOnStack = false;
+				Component.Add(ComponentNodeIndex);
+			}
+			while (ComponentNodeIndex != NodeIndex);
+		}
+	};
+
+	for (int32 NodeIndex = 0; NodeIndex < Nodes.Num(); ++NodeIndex)
+	{
+		if (VisitStates[NodeIndex].Index == INDEX_NONE)
+		{
+			Visit(NodeIndex);
+		}
+	}
+
+	for (int32 ComponentIndex = 0; ComponentIndex < Components.Num(); ++ComponentIndex)
+	{
+		const TArray<int32>& Component = Components[ComponentIndex];
+		for (const int32 NodeIndex : Component)
+		{
+			Nodes[NodeIndex].Order = Components.Num() - 1 - ComponentIndex;
+		}
+
+#if !UE_BUILD_SHIPPING
+		const bool bIsCycle = Component.Num() > 1 || Nodes[Component[0]].Dependents.Contains(Component[0]);
+		if (bIsCycle)
+		{
+			FString CycleDescription;
+			for (const int32 NodeIndex : Component)
+			{
+				CycleDescription += (CycleDescription.IsEmpty() ? TEXT("") : TEXT(", ")) + Nodes[NodeIndex].Setting->GetDevName().ToString();
+			}
+
+			bool bAlreadyReported = false;
+			ReportedCycles.Add(CycleDescription, &bAlreadyReported);
+			UE_CLOG(!bAlreadyReported, LogGameSettings, Warning, TEXT("Edit dependency cycle, these settings are evaluated together: %s"), *CycleDescription);
+		}
+#endif
+	}
+}
+
+bool FGameSettingEditDependencyGraph::HasDependents(const UGameSetting* InSetting) const
+{
+	const int32* NodeIndex = NodeIndices.Find(InSetting);
+	return NodeIndex && Nodes[*NodeIndex].Dependents.Num() > 0;
+}
+
+void FGameSettingEditDependencyGraph::GatherAffectedSettings(TConstArrayView<UGameSetting*> ChangedSettings, TArray<UGameSetting*>& OutAffectedSettings) const
+{
+	TBitArray<> Affected(false, Nodes.Num());
+	TArray<int32> AffectedIndices;
+	TArray<int32> ToVisit;
+
+	for (const UGameSetting* ChangedSetting : ChangedSettings)
+	{
+		if (const int32* NodeIndex = NodeIndices.Find(ChangedSetting))
+		{
+			ToVisit.Push(*NodeIndex);
+		}
+	}
+
+	while (ToVisit.Num() > 0)
+	{
+		for (const int32 DependentIndex : Nodes[ToVisit.Pop()].Dependents)
+		{
+			if (!Affected[DependentIndex])
+			{
+				Affected[DependentIndex] = true;
+				AffectedIndices.Add(DependentIndex);
+				ToVisit.Push(DependentIndex);
+			}
+		}
+	}
+
+	AffectedIndices.Sort([this](const int32 A, const int32 B)
+	{
+		return Nodes[A].Order != Nodes[B].Order ? Nodes[A].Order < Nodes[B].Order : A < B;
+	});
+
+	OutAffectedSettings.Reserve(OutAffectedSettings.Num() + AffectedIndices.Num());
+	for (const int32 NodeIndex : AffectedIndices)
+	{
+		if (UGameSetting* Setting = Nodes[NodeIndex].Setting.Get())
+		{
+			OutAffectedSettings.Add(Setting);
+		}
+	}
+}
@@ -0,0 +1,236 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "GameSettingFlatTree.h"
+
+#include "GameSettingCollection.h"
+#include "Async/ParallelFor.h"
+#include "GameSettingFilterState.h"
+#include "Misc/ScopeExit.h"
+
+//--------------------------------------
+// FGameSettingFlatTree
+//--------------------------------------
+
+void FGameSettingFlatTree::Reset()
+{
+	Settings.Reset();
+	Kinds.Reset();
+	SubtreeEnds.Reset();
+	EditableBits.Reset();
+	EditableBitsEpoch = 0;
+	Indices.Reset();
+}
+
+void FGameSettingFlatTree::Build(TConstArrayView<TObjectPtr<UGameSetting>> InTopLevelSettings)
+{
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_FGameSettingFlatTree_Build);
+
+	Reset();
+
+	for (UGameSetting* TopLevelSetting : InTopLevelSettings)
+	{
+		if (TopLevelSetting)
+		{
+			AddSubtree(TopLevelSetting);
+		}
+	}
+}
+
+bool FGameSettingFlatTree::HasCustomFilter(const UGameSettingCollection* InCollection)
+{
+	// Blueprint classes can't override GetSettingsForFilter, only look at the native class.
+	const UClass* NativeClass = InCollection->GetClass();
+	while (!NativeClass->HasAnyClassFlags(CLASS_Native))
+	{
+		NativeClass = NativeClass->GetSuperClass();
+	}
+
+	return NativeClass != UGameSettingCollection::StaticClass() && NativeClass != UGameSettingCollectionPage::StaticClass();
+}
+
+void FGameSettingFlatTree::AddSubtree(UGameSetting* InSetting)
+{
+	const int32 Index = Settings.Add(InSetting);
+	SubtreeEnds.Add(INDEX_NONE);
+	Indices.Add(InSetting, Index);
+
+	// Only collections filter their children, anything else's children are never reached by filtering.
+	if (UGameSettingCollection* Collection = Cast<UGameSettingCollection>(InSetting))
+	{
+		const bool bIsPage = Cast<UGameSettingCollectionPage>(Collection) != nullptr;
+		if (HasCustomFilter(Collection))
+		{
+			Kinds.Add(bIsPage ? EKind::CustomPage : EKind::CustomCollection);
+		}
+		else
+		{
+			Kinds.Add(bIsPage ? EKind::Page : EKind::Collection);
+		}
+
+		for (UGameSetting* ChildSetting : Collection->GetChildSettings())
+		{
+			if (ChildSetting)
+			{
+				AddSubtree(ChildSetting);
+			}
+		}
+	}
+	else
+	{
+		Kinds.Add(EKind::Setting);
+	}
+
+	SubtreeEnds[Index] = Settings.Num();
+}
+
+void FGameSettingFlatTree::RefreshEditableBits()
+{
+	const uint32 FilterableStateEpoch = UGameSetting::GetFilterableStateEpoch();
+	if (EditableBits.Num() == Settings.Num() && EditableBitsEpoch == FilterableStateEpoch)
+	{
+		return;
+	}
+
+	EditableBits.SetNumUninitialized(Settings.Num());
+	for (int32 Index = 0; Index < Settings.Num(); ++Index)
+	{
+		const FGameSettingEditableState& EditState = Settings[Index]->GetEditState();
+		EditableBits[Index] =
+			(EditState.IsVisible() ? Visible : 0) |
+			(EditState.IsEnabled() ? Enabled : 0) |
+			(EditState.IsResetable() ? Resetable : 0);
+	}
+
+	EditableBitsEpoch = FilterableStateEpoch;
+}
+
+void FGameSettingFlatTree::GetSettingsForFilter(const FGameSettingFilterState& FilterState, int32 RootIndex, TArray<UGameSetting*>& InOutSettings, bool bParallelTextFilter)
+{
+	if (!ensure(Settings.IsValidIndex(RootIndex)))
+	{
+		return;
+	}
+
+	RefreshEditableBits();
+
+	if (Kinds[RootIndex] == EKind::CustomCollection || Kinds[RootIndex] == EKind::CustomPage)
+	{
+		CastChecked<UGameSettingCollection>(Settings[RootIndex])->GetSettingsForFilter(FilterState, InOutSettings);
+		return;
+	}
+
+	if (bParallelTextFilter)
+	{
+		FilterTextInParallel(FilterState, RootIndex);
+	}
+
+	ON_SCOPE_EXIT
+	{
+		TextFilterResults.Reset();
+		TextFilterResultsBegin = INDEX_NONE;
+	};
+
+	switch (Kinds[RootIndex])
+	{
+	case EKind::Page:
+		// Pages only show their settings when they're the page being shown, nested pages are displayed elsewhere.
+		if (FilterState.bIncludeNestedPages || FilterState.IsSettingInRootList(Settings[RootIndex]))
+		{
+			GatherChildrenForFilter(FilterState, RootIndex, InOutSettings);
+		}
+		break;
+
+	case EKind::Collection:
+		GatherChildrenForFilter(FilterState, RootIndex, InOutSettings);
+		break;
+
+	default:
+		if (DoesSettingPassFilter(FilterState, RootIndex))
+		{
+			InOutSettings.Add(Settings[RootIndex]);
+		}
+		break;
+	}
+}
+
+void FGameSettingFlatTree::FilterTextInParallel(const FGameSettingFilterState& FilterState, int32 RootIndex)
+{
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_FGameSettingFlatTree_FilterTextInParallel);
+
+	// Generating the searchable text isn't thread safe, so snapshot it on the game thread first, it's usually cached.
+	const int32 NumSettings = SubtreeEnds[RootIndex] - RootIndex;
+	TArray<const FString*> SearchableTexts;
+	SearchableTexts.Reserve(NumSettings);
+	for (int32 Index = RootIndex; Index < SubtreeEnds[RootIndex]; ++Index)
+	{
+		SearchableTexts.Add(&Settings[Index]->GetDescriptionPlainText());
+	}
+
+	TextFilterResults.SetNumUninitialized(NumSettings);
+	TextFilterResultsBegin = RootIndex;
+
+	ParallelFor(NumSettings, [this, &FilterState, &SearchableTexts](int32 SnapshotIndex)
+	{
+		TextFilterResults[SnapshotIndex] = FilterState.DoesTextPassFilter(*SearchableTexts[SnapshotIndex]) ? 1 : 0;
+	});
+}
+
+void FGameSettingFlatTree::GatherChildrenForFilter(const FGameSettingFilterState& FilterState, int32 CollectionIndex, TArray<UGameSetting*>& InOutSettings) const
+{
+	for (int32 Index = CollectionIndex + 1; Index < SubtreeEnds[CollectionIndex]; Index = SubtreeEnds[Index])
+	{
+		switch (Kinds[Index])
+		{
+		case EKind::Collection:
+		case EKind::CustomCollection:
+		{
+			// Only add the collection if it has any visible children, and never the root it was reached from.
+			const int32 CollectionSettingIndex = InOutSettings.Add(Settings[Index]);
+			if (Kinds[Index] == EKind::CustomCollection)
+			{
+				CastChecked<UGameSettingCollection>(Settings[Index])->GetSettingsForFilter(FilterState, InOutSettings);
+			}
+			else
+			{
+				GatherChildrenForFilter(FilterState, Index, InOutSettings);
+			}
+
+			if (InOutSettings.Num() == CollectionSettingIndex + 1)
+			{
+				InOutSettings.Pop(EAllowShrinking::No);
+			}
+			else if (FilterState.IsSettingInRootList(Settings[Index]))
+			{
+				InOutSettings.RemoveAt(CollectionSettingIndex, 1, EAllowShrinking::No);
+			}
+			break;
+		}
+
+		default:
+			// Pages nested in a collection are only navigated to, their settings are never included.
+			if (DoesSettingPassFilter(FilterState, Index))
+			{
+				InOutSettings.Add(Settings[Index]);
+			}
+			break;
+		}
+	}
+}
+
+bool FGameSettingFlatTree::DoesSettingPassFilter(const FGameSettingFilterState& FilterState, int32 Index) const
+{
+	const uint8 Bits = EditableBits[Index];
+	if ((!FilterState.bIncludeHidden && !(Bits & Visible)) ||
+		(!FilterState.bIncludeDisabled && !(Bits & Enabled)) ||
+		(!FilterState.bIncludeResetable && !(Bits & Resetable)))
+	{
+		return false;
+	}
+
+	if (TextFilterResultsBegin != INDEX_NONE)
+	{
+		return FilterState.DoesSettingPassFilterIgnoringText(*Settings[Index]) && TextFilterResults[Index - TextFilterResultsBegin];
+	}
+
+	return FilterState.DoesSettingPassFilter(*Settings[Index]);
+}
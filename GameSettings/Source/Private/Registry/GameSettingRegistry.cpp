@@ -4,117 +4,1066 @@
 
 #include "GameSettingCollection.h"
 #include "GameSettingAction.h"
+#include "GameSettingProfiling.h"
+#include "GameSettingRegistryDefinition.h"
+#include "GameSettingValueDiscrete.h"
+#include "HAL/IConsoleManager.h"
+#include "Internationalization/Internationalization.h"
+#include "Misc/Paths.h"
+#include "UObject/UObjectIterator.h"
 #include "UObject/WeakObjectPtr.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(GameSettingRegistry)
 
 #define LOCTEXT_NAMESPACE "GameSetting"
 
+DECLARE_CYCLE_STAT(TEXT("Registry GetSettingsForFilter"), STAT_GameSettingRegistry_GetSettingsForFilter, STATGROUP_GameSettings);
+
+DEFINE_LOG_CATEGORY_STATIC(LogGameSettings, Log, All);
+
+namespace GameSettingRegistry
+{
+	/** How many recent GetSettingsForFilter results are kept, a screen usually only switches between a few filters. */
+	static constexpr int32 MaxCachedFilterResults = 4;
+
+	static int32 ParallelFilterMinSettings = 0;
+	static FAutoConsoleVariableRef CVarParallelFilterMinSettings(
+		TEXT("GameSettings.ParallelFilterMinSettings"),
+		ParallelFilterMinSettings,
+		TEXT("When searching a root with at least this many settings under it, test the search text in parallel.  0 disables it."),
+		ECVF_Default);
+
+	/** How long the plain text warm up may run each frame. */
+	static constexpr double PlainTextWarmupBudgetSeconds = 0.001;
+
+	/** Re-evaluating dependents may change other settings in turn, this bounds how many times that can repeat in one change. */
+	static constexpr int32 MaxEditDependencyPasses = 16;
+
+	static bool bUseRegistrySnapshot = false;
+	static FAutoConsoleVariableRef CVarUseRegistrySnapshot(
+		TEXT("GameSettings.UseRegistrySnapshot"),
+		bUseRegistrySnapshot,
+		TEXT("Load a snapshot of each registry's setting tree when it's created, so looking up a setting only builds the lazy setting it's under.  Snapshots are staged with GameSettings.SaveRegistrySnapshots, outside of shipping builds one is also written whenever a registry's whole tree happens to be built."),
+		ECVF_Default);
+
+	static bool bValidateRegistrySnapshot = false;
+	static FAutoConsoleVariableRef CVarValidateRegistrySnapshot(
+		TEXT("GameSettings.ValidateRegistrySnapshot"),
+		bValidateRegistrySnapshot,
+		TEXT("Whenever a registry's whole setting tree is built, diff it against the snapshot, logging and rewriting it if they differ."),
+		ECVF_Default);
+}
+
 //--------------------------------------
 // UGameSettingRegistry
 //--------------------------------------
 
-UGameSettingRegistry::UGameSettingRegistry()
-{
+UGameSettingRegistry::UGameSettingRegistry()
+{
+}
+
+void UGameSettingRegistry::Initialize(ULocalPlayer* InLocalPlayer)
+{
+	OwningLocalPlayer = InLocalPlayer;
+	FInternationalization::Get().OnCultureChanged().AddUObject(this, &ThisClass::HandleCultureChanged);
+
+	if (GameSettingRegistry::bUseRegistrySnapshot)
+	{
+		bSnapshotUpToDate = Snapshot.LoadFromFile(GetSnapshotFilename(), GetSnapshotDefinitionVersion());
+	}
+
+	{
+		// Settings waiting on startup providers start up once they're all registered.
+		FGameSettingStartupBatchScope StartupBatch(*StartupScheduler, InLocalPlayer);
+
+		// Every setting gathers its edit state as it initializes, and nothing changes while they do.
+		FGameSettingEditConditionCacheScope EditConditionCache;
+		TGuardValue<bool> InitializingGuard(bInOnInitialize, true);
+		OnInitialize(InLocalPlayer);
+	}
+
+	UpdateSnapshotIfComplete();
+
+	// Settings that were ready as soon as they were registered never report it, so nothing else would broadcast.
+	BroadcastIfFinishedInitializing();
+
+	//UGameFeaturesSubsystem
+}
+
+void UGameSettingRegistry::Regenerate()
+{
+	for (UGameSetting* Setting : RegisteredSettings)
+	{
+		Setting->OnSettingReadyEvent.RemoveAll(this);
+		Setting->MarkAsGarbage();
+	}
+	for (UGameSetting* Setting : RetiredSettings)
+	{
+		Setting->MarkAsGarbage();
+	}
+	RetiredSettings.Reset();
+	RegisteredSettings.Reset();
+	RegisteredSettingsByDevName.Reset();
+	TopLevelSettings.Reset();
+	LazySettingBuilders.Reset();
+	LazySettingsByInnerDevName.Reset();
+	PendingDefinitionRoots.Reset();
+	RegisteredDefinitions.Reset();
+	NumSettingsPendingStartup = 0;
+	EditDependencyGraph.Reset();
+	SearchIndex.Reset();
+	FilterResultCache.Reset();
+	NextFilterResultIndex = 0;
+	StructureVersion++;
+	BatchedSettingChanges.Reset();
+	BatchedEditConditionChanges.Reset();
+	StartupScheduler->Reset();
+
+	{
+		FGameSettingStartupBatchScope StartupBatch(*StartupScheduler, OwningLocalPlayer);
+		FGameSettingEditConditionCacheScope EditConditionCache;
+		TGuardValue<bool> InitializingGuard(bInOnInitialize, true);
+		OnInitialize(OwningLocalPlayer);
+	}
+
+	UpdateSnapshotIfComplete();
+	BroadcastIfFinishedInitializing();
+}
+
+void UGameSettingRegistry::RegenerateIncremental()
+{
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_UGameSettingRegistry_RegenerateIncremental);
+
+	const TArray<TObjectPtr<UGameSetting>> PreviousSettings = MoveTemp(RegisteredSettings);
+	for (UGameSetting* Setting : PreviousSettings)
+	{
+		UnbindSetting(Setting);
+	}
+
+	// Every reused setting takes the edit conditions of this build, so nothing refers to the last build's anymore.
+	const TArray<TObjectPtr<UGameSetting>> PreviousRetiredSettings = MoveTemp(RetiredSettings);
+	RetiredSettings.Reset();
+
+	// Lazy stand ins are never reused, only the settings that have actually been built.
+	ReusableSettings = MoveTemp(RegisteredSettingsByDevName);
+	for (auto It = ReusableSettings.CreateIterator(); It; ++It)
+	{
+		if (LazySettingBuilders.Contains(It.Key()))
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	RegisteredSettings.Reset();
+	RegisteredSettingsByDevName.Reset();
+	TopLevelSettings.Reset();
+	LazySettingBuilders.Reset();
+	LazySettingsByInnerDevName.Reset();
+	PendingDefinitionRoots.Reset();
+	RegisteredDefinitions.Reset();
+	NumSettingsPendingStartup = 0;
+	StructureVersion++;
+	BatchedSettingChanges.Reset();
+	BatchedEditConditionChanges.Reset();
+	StartupScheduler->Reset();
+
+	// Registration swaps the reusable settings into the fresh tree as it's registered.
+	{
+		FGameSettingStartupBatchScope StartupBatch(*StartupScheduler, OwningLocalPlayer);
+		FGameSettingEditConditionCacheScope EditConditionCache;
+		TGuardValue<bool> InitializingGuard(bInOnInitialize, true);
+		OnInitialize(OwningLocalPlayer);
+	}
+
+	RebindReusedEditDependencies();
+
+	TSet<UGameSetting*> KeptSettings;
+	KeptSettings.Reserve(RegisteredSettings.Num());
+	for (UGameSetting* Setting : RegisteredSettings)
+	{
+		KeptSettings.Add(Setting);
+	}
+
+	for (UGameSetting* Setting : PreviousSettings)
+	{
+		if (!KeptSettings.Contains(Setting))
+		{
+			Setting->MarkAsGarbage();
+		}
+	}
+
+	for (UGameSetting* Setting : PreviousRetiredSettings)
+	{
+		Setting->MarkAsGarbage();
+	}
+
+	// The edit conditions copied onto the reused settings may point at the fresh settings they replaced, which read
+	// the same data sources, so those are kept alive rather than destroyed.
+	for (const TPair<TObjectPtr<UGameSetting>, TObjectPtr<UGameSetting>>& Replaced : ReplacedSettings)
+	{
+		RetiredSettings.Add(Replaced.Key);
+	}
+
+	ReusableSettings.Reset();
+	ReplacedSettings.Reset();
+
+	UpdateSnapshotIfComplete();
+	BroadcastIfFinishedInitializing();
+}
+
+UGameSetting* UGameSettingRegistry::ReuseExistingSettings(UGameSetting* InSetting)
+{
+	if (ReusableSettings.Num() == 0)
+	{
+		return InSetting;
+	}
+
+	UGameSetting* Setting = InSetting;
+
+	TObjectPtr<UGameSetting> ExistingSetting;
+	if (ReusableSettings.RemoveAndCopyValue(InSetting->GetDevName(), ExistingSetting) && ExistingSetting->CanBeReusedFor(*InSetting))
+	{
+		ExistingSetting->CopyDefinitionFrom(*InSetting);
+		ReplacedSettings.Add(InSetting, ExistingSetting);
+		Setting = ExistingSetting;
+	}
+
+	if (UGameSettingCollection* Collection = Cast<UGameSettingCollection>(Setting))
+	{
+		// Collections take the freshly built list of children, with any reusable children swapped in.
+		TArray<UGameSetting*> ChildSettings = InSetting->GetChildSettings();
+		for (UGameSetting*& ChildSetting : ChildSettings)
+		{
+			ChildSetting = ReuseExistingSettings(ChildSetting);
+		}
+
+		Collection->SetSettings(ChildSettings);
+	}
+	else if (Setting != InSetting)
+	{
+		// Anything else keeps its own children, so they can't be reused elsewhere.
+		TArray<UGameSetting*> InnerSettings = Setting->GetChildSettings();
+		while (InnerSettings.Num() > 0)
+		{
+			UGameSetting* InnerSetting = InnerSettings.Pop();
+			ReusableSettings.Remove(InnerSetting->GetDevName());
+			InnerSettings.Append(InnerSetting->GetChildSettings());
+		}
+	}
+
+	return Setting;
+}
+
+void UGameSettingRegistry::RebindReusedEditDependencies()
+{
+	if (ReplacedSettings.Num() == 0)
+	{
+		return;
+	}
+
+	TMap<UGameSetting*, UGameSetting*> FreshSettingsByReused;
+	FreshSettingsByReused.Reserve(ReplacedSettings.Num());
+	for (const TPair<TObjectPtr<UGameSetting>, TObjectPtr<UGameSetting>>& Replaced : ReplacedSettings)
+	{
+		FreshSettingsByReused.Add(Replaced.Value, Replaced.Key);
+	}
+
+	for (UGameSetting* Setting : RegisteredSettings)
+	{
+		// Dependencies always come from the fresh build, the same as the edit conditions copied onto reused settings.
+		UGameSetting* FreshSetting = FreshSettingsByReused.FindRef(Setting);
+		UGameSetting* Definition = FreshSetting ? FreshSetting : Setting;
+
+		const bool bNeedsRebind = FreshSetting || Definition->GetEditDependencies().ContainsByPredicate([this](UGameSetting* DependencySetting)
+		{
+			return ReplacedSettings.Contains(DependencySetting);
+		});
+
+		if (!bNeedsRebind)
+		{
+			continue;
+		}
+
+		const TArray<TObjectPtr<UGameSetting>> Dependencies = Definition->GetEditDependencies();
+		Definition->ClearEditDependencies();
+		Setting->ClearEditDependencies();
+
+		for (UGameSetting* DependencySetting : Dependencies)
+		{
+			const TObjectPtr<UGameSetting>* ReusedDependency = ReplacedSettings.Find(DependencySetting);
+			Setting->AddEditDependency(ReusedDependency ? ReusedDependency->Get() : DependencySetting);
+		}
+
+		if (FreshSetting)
+		{
+			Setting->RefreshEditableState(false);
+		}
+	}
+
+	bEditDependencyGraphDirty = true;
+}
+
+void UGameSettingRegistry::UnbindSetting(UGameSetting* InSetting)
+{
+	InSetting->OnSettingChangedEvent.RemoveAll(this);
+	InSetting->OnSettingAppliedEvent.RemoveAll(this);
+	InSetting->OnSettingEditConditionChangedEvent.RemoveAll(this);
+	InSetting->OnSettingReadyEvent.RemoveAll(this);
+	InSetting->SetRegistry(nullptr);
+
+	if (UGameSettingAction* ActionSetting = Cast<UGameSettingAction>(InSetting))
+	{
+		ActionSetting->OnExecuteNamedActionEvent.RemoveAll(this);
+	}
+	else if (UGameSettingCollectionPage* PageCollection = Cast<UGameSettingCollectionPage>(InSetting))
+	{
+		PageCollection->OnExecuteNavigationEvent.RemoveAll(this);
+	}
+}
+
+bool UGameSettingRegistry::IsFinishedInitializing() const
+{
+	return NumSettingsPendingStartup == 0;
+}
+
+void UGameSettingRegistry::BroadcastIfFinishedInitializing()
+{
+	if (IsFinishedInitializing())
+	{
+		OnFinishedInitializingEvent.Broadcast();
+		StartPlainTextWarmup();
+	}
+}
+
+void UGameSettingRegistry::StartPlainTextWarmup(int32 InFirstSettingIndex)
+{
+	// A pass that's already running just goes back far enough to cover the new settings.
+	if (PlainTextWarmupHandle.IsValid())
+	{
+		NextPlainTextWarmupIndex = FMath::Min(NextPlainTextWarmupIndex, InFirstSettingIndex);
+		return;
+	}
+
+	NextPlainTextWarmupIndex = InFirstSettingIndex;
+
+	PlainTextWarmupHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateWeakLambda(this, [this](float DeltaTime)
+	{
+		QUICK_SCOPE_CYCLE_COUNTER(STAT_UGameSettingRegistry_PlainTextWarmup);
+
+		const double EndTime = FPlatformTime::Seconds() + GameSettingRegistry::PlainTextWarmupBudgetSeconds;
+		while (NextPlainTextWarmupIndex < RegisteredSettings.Num())
+		{
+			if (const UGameSetting* Setting = RegisteredSettings[NextPlainTextWarmupIndex++])
+			{
+				Setting->GetDescriptionPlainText();
+			}
+
+			if (FPlatformTime::Seconds() >= EndTime)
+			{
+				return true;
+			}
+		}
+
+		PlainTextWarmupHandle.Reset();
+		return false;
+	}));
+}
+
+void UGameSettingRegistry::HandleCultureChanged()
+{
+	// Option texts are localized, anything built from them has to be rebuilt.
+	for (UGameSetting* Setting : RegisteredSettings)
+	{
+		if (UGameSettingValueDiscrete* DiscreteSetting = Cast<UGameSettingValueDiscrete>(Setting))
+		{
+			DiscreteSetting->MarkDiscreteOptionsChanged();
+		}
+	}
+
+	// The module already invalidated every setting's plain text, generate it again before anyone searches.
+	if (IsFinishedInitializing())
+	{
+		StartPlainTextWarmup();
+	}
+}
+
+void UGameSettingRegistry::SaveChanges()
+{
+	SaveChanges(FGameSettingApplyCategories::All());
+}
+
+void UGameSettingRegistry::SaveChanges(const FGameSettingApplyCategories& DirtyCategories)
+{
+	// Intentionally empty, the base registry has nothing to apply.  Subclasses run their own apply paths for the dirty categories.
+}
+
+void UGameSettingRegistry::GetSettingsForFilter(const FGameSettingFilterState& FilterState, TArray<UGameSetting*>& InOutSettings)
+{
+	SCOPE_CYCLE_COUNTER(STAT_GameSettingRegistry_GetSettingsForFilter);
+
+	TArray<UGameSetting*> RootSettings;
+	if (FilterState.GetSettingRootList().Num() > 0)
+	{
+		RootSettings.Append(FilterState.GetSettingRootList());
+	}
+	else
+	{
+		// Without a root we filter what's been built, building every lazy setting here would undo them.
+		for (UGameSetting* TopLevelSetting : TopLevelSettings)
+		{
+			if (!IsLazySettingPending(TopLevelSetting))
+			{
+				RootSettings.Add(TopLevelSetting);
+			}
+		}
+	}
+
+	// Refreshes caused by value changes filter exactly the same way they did last time.
+	const uint32 FilterHash = GetTypeHash(FilterState);
+	const uint32 FilterableStateEpoch = UGameSetting::GetFilterableStateEpoch();
+	const uint32 SearchableTextEpoch = UGameSetting::GetSearchableTextEpoch();
+	for (const FFilterResult& CachedResult : FilterResultCache)
+	{
+		if (CachedResult.FilterHash == FilterHash &&
+			CachedResult.StructureVersion == StructureVersion &&
+			CachedResult.FilterableStateEpoch == FilterableStateEpoch &&
+			CachedResult.SearchableTextEpoch == SearchableTextEpoch &&
+			CachedResult.FilterState.IsSameFilter(FilterState))
+		{
+			InOutSettings.Append(CachedResult.Settings);
+			return;
+		}
+	}
+
+	TArray<UGameSetting*> FilteredSettings;
+
+	// Narrow the search down to the settings it could match before testing each of them.
+	TSet<const UGameSetting*> SearchCandidates;
+	const FString SearchText = FilterState.GetSearchText().ToString();
+	const bool bHasSearchCandidates = !SearchText.IsEmpty() && SearchIndex.GatherCandidates(RegisteredSettings, SearchText, SearchCandidates);
+	TGuardValue<const TSet<const UGameSetting*>*> SearchCandidatesGuard(FilterState.SearchCandidates, bHasSearchCandidates ? &SearchCandidates : nullptr);
+
+	RebuildSettingTreeIfStale();
+
+	for (UGameSetting* TopLevelSetting : RootSettings)
+	{
+		// Roots should come from FindSettingByDevName, which never hands out a pending stand in.
+		if (!ensureMsgf(!IsLazySettingPending(TopLevelSetting), TEXT("Filtering on lazy setting %s before it was built."), *TopLevelSetting->GetDevName().ToString()))
+		{
+			continue;
+		}
+
+		const int32 RootIndex = SettingTree.FindIndex(TopLevelSetting);
+		if (RootIndex != INDEX_NONE)
+		{
+			const bool bParallelTextFilter = GameSettingRegistry::ParallelFilterMinSettings > 0 && !SearchText.IsEmpty() &&
+				SettingTree.GetSubtreeNum(RootIndex) >= GameSettingRegistry::ParallelFilterMinSettings;
+
+			SettingTree.GetSettingsForFilter(FilterState, RootIndex, FilteredSettings, bParallelTextFilter);
+		}
+		else
+		{
+			GetSettingsForFilterRecursive(FilterState, TopLevelSetting, FilteredSettings);
+		}
+	}
+
+	InOutSettings.Append(FilteredSettings);
+
+	if (FilterResultCache.Num() < GameSettingRegistry::MaxCachedFilterResults)
+	{
+		FilterResultCache.AddDefaulted();
+	}
+
+	FFilterResult& NewResult = FilterResultCache[NextFilterResultIndex];
+	NextFilterResultIndex = (NextFilterResultIndex + 1) % GameSettingRegistry::MaxCachedFilterResults;
+
+	NewResult.FilterHash = FilterHash;
+	NewResult.FilterState = FilterState;
+	NewResult.FilterState.SearchCandidates = nullptr;
+	NewResult.StructureVersion = StructureVersion;
+	NewResult.FilterableStateEpoch = FilterableStateEpoch;
+	NewResult.SearchableTextEpoch = SearchableTextEpoch;
+	NewResult.Settings = MoveTemp(FilteredSettings);
+}
+
+void UGameSettingRegistry::GetSettingsForFilterRecursive(const FGameSettingFilterState& FilterState, UGameSetting* InRootSetting, TArray<UGameSetting*>& InOutSettings) const
+{
+	if (const UGameSettingCollection* RootCollection = Cast<UGameSettingCollection>(InRootSetting))
+	{
+		RootCollection->GetSettingsForFilter(FilterState, InOutSettings);
+	}
+	else
+	{
+		if (FilterState.DoesSettingPassFilter(*InRootSetting))
+		{
+			InOutSettings.Add(InRootSetting);
+		}
+	}
+}
+
+void UGameSettingRegistry::RebuildSettingTreeIfStale()
+{
+	if (SettingTreeStructureVersion != StructureVersion)
+	{
+		SettingTree.Build(TopLevelSettings);
+		SettingTreeStructureVersion = StructureVersion;
+	}
+}
+
+#if !UE_BUILD_SHIPPING
+void UGameSettingRegistry::BenchmarkSettingsForFilter(int32 Iterations, const FString& SearchText)
+{
+	FGameSettingFilterState FilterState;
+	FilterState.bIncludeHidden = true;
+	FilterState.bIncludeNestedPages = true;
+	FilterState.SetSearchText(SearchText);
+
+	RebuildSettingTreeIfStale();
+
+	TArray<UGameSetting*> RootSettings;
+	for (UGameSetting* TopLevelSetting : TopLevelSettings)
+	{
+		if (!IsLazySettingPending(TopLevelSetting))
+		{
+			RootSettings.Add(TopLevelSetting);
+		}
+	}
+
+	auto TimeFilter = [&](TArray<UGameSetting*>& OutSettings, TFunctionRef<void(UGameSetting*)> FilterRoot)
+	{
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+		{
+			OutSettings.Reset();
+			for (UGameSetting* RootSetting : RootSettings)
+			{
+				FilterRoot(RootSetting);
+			}
+		}
+		return (FPlatformTime::Seconds() - StartTime) * 1000000.0 / Iterations;
+	};
+
+	TArray<UGameSetting*> FlatSettings;
+	const double FlatMicroseconds = TimeFilter(FlatSettings, [&](UGameSetting* RootSetting)
+	{
+		SettingTree.GetSettingsForFilter(FilterState, SettingTree.FindIndex(RootSetting), FlatSettings);
+	});
+
+	TArray<UGameSetting*> ParallelSettings;
+	const double ParallelMicroseconds = TimeFilter(ParallelSettings, [&](UGameSetting* RootSetting)
+	{
+		SettingTree.GetSettingsForFilter(FilterState, SettingTree.FindIndex(RootSetting), ParallelSettings, true);
+	});
+
+	TArray<UGameSetting*> RecursiveSettings;
+	const double RecursiveMicroseconds = TimeFilter(RecursiveSettings, [&](UGameSetting* RootSetting)
+	{
+		GetSettingsForFilterRecursive(FilterState, RootSetting, RecursiveSettings);
+	});
+
+	const bool bResultsMatch = FlatSettings == RecursiveSettings && ParallelSettings == RecursiveSettings;
+	UE_LOG(LogConsoleResponse, Display, TEXT("%s: %d of %d settings, flattened %.2fus, flattened parallel %.2fus, recursive %.2fus per filter%s"),
+		*GetName(), FlatSettings.Num(), SettingTree.Num(), FlatMicroseconds, ParallelMicroseconds, RecursiveMicroseconds,
+		bResultsMatch ? TEXT("") : TEXT(", RESULTS DIFFER"));
+}
+
+void UGameSettingRegistry::CompareWithDefinition(const UGameSettingRegistryDefinition* InDefinition, TArray<FString>& OutDifferences)
+{
+	TArray<TObjectPtr<UGameSetting>> RegistrySettings;
+	TArray<TObjectPtr<UGameSetting>> DefinitionSettings;
+
+	for (const int32 RootIndex : InDefinition->GetRootIndices())
+	{
+		const FName DevName = InDefinition->GetSettings()[RootIndex].DevName;
+
+		UGameSetting* RegistrySetting = FindSettingByDevName(DevName);
+		if (!RegistrySetting)
+		{
+			OutDifferences.Add(FString::Printf(TEXT("%s: not in the registry"), *DevName.ToString()));
+			continue;
+		}
+
+		if (UGameSetting* DefinitionSetting = InDefinition->BuildSettings(RootIndex, [this](const FName& InDevName) { return FindSettingByDevName(InDevName); }))
+		{
+			RegistrySettings.Add(RegistrySetting);
+			DefinitionSettings.Add(DefinitionSetting);
+		}
+	}
+
+	FGameSettingRegistrySnapshot RegistrySnapshot;
+	RegistrySnapshot.Capture(RegistrySettings, 0);
+
+	FGameSettingRegistrySnapshot DefinitionSnapshot;
+	DefinitionSnapshot.Capture(DefinitionSettings, 0);
+
+	RegistrySnapshot.Diff(DefinitionSnapshot, OutDifferences);
+
+	for (UGameSetting* DefinitionSetting : DefinitionSettings)
+	{
+		DefinitionSetting->MarkAsGarbage();
+	}
+}
+
+static FAutoConsoleCommand CmdCompareRegistryDefinition(
+	TEXT("GameSettings.CompareRegistryDefinition"),
+	TEXT("Builds the settings of a registry definition asset, and compares them with the settings every registry has under the same DevNames.  Usage: GameSettings.CompareRegistryDefinition <AssetPath>"),
+	FConsoleCommandWithArgsDelegate::CreateStatic([](const TArray<FString>& Args)
+	{
+		const UGameSettingRegistryDefinition* Definition = Args.Num() > 0 ? LoadObject<UGameSettingRegistryDefinition>(nullptr, *Args[0]) : nullptr;
+		if (!Definition)
+		{
+			UE_LOG(LogConsoleResponse, Warning, TEXT("Couldn't load a registry definition from '%s'."), Args.Num() > 0 ? *Args[0] : TEXT(""));
+			return;
+		}
+
+		for (TObjectIterator<UGameSettingRegistry> It; It; ++It)
+		{
+			if (It->HasAnyFlags(RF_ClassDefaultObject))
+			{
+				continue;
+			}
+
+			TArray<FString> Differences;
+			It->CompareWithDefinition(Definition, Differences);
+
+			UE_LOG(LogConsoleResponse, Display, TEXT("%s: %s %s"), *It->GetName(), *Definition->GetName(), Differences.Num() == 0 ? TEXT("matches") : TEXT("differs"));
+			for (const FString& Difference : Differences)
+			{
+				UE_LOG(LogConsoleResponse, Display, TEXT("  %s"), *Difference);
+			}
+		}
+	}));
+
+static FAutoConsoleCommand CmdSaveRegistrySnapshots(
+	TEXT("GameSettings.SaveRegistrySnapshots"),
+	TEXT("Builds the whole setting tree of every registry and writes its snapshot, for staging them ahead of time."),
+	FConsoleCommandDelegate::CreateStatic([]()
+	{
+		for (TObjectIterator<UGameSettingRegistry> It; It; ++It)
+		{
+			if (!It->HasAnyFlags(RF_ClassDefaultObject))
+			{
+				It->SaveSnapshot();
+			}
+		}
+	}));
+
+static FAutoConsoleCommand CmdBenchmarkFilter(
+	TEXT("GameSettings.BenchmarkFilter"),
+	TEXT("Times filtering the whole setting tree of every registry: flattened, flattened with the parallel text filter, and by recursing through the collections, and checks they agree.  Usage: GameSettings.BenchmarkFilter [Iterations] [SearchText...]"),
+	FConsoleCommandWithArgsDelegate::CreateStatic([](const TArray<FString>& Args)
+	{
+		int32 Iterations = 1000;
+		if (Args.Num() > 0)
+		{
+			LexFromString(Iterations, *Args[0]);
+		}
+		Iterations = FMath::Max(Iterations, 1);
+
+		const FString SearchText = FString::Join(TArrayView<const FString>(Args).RightChop(1), TEXT(" "));
+
+		for (TObjectIterator<UGameSettingRegistry> It; It; ++It)
+		{
+			if (!It->HasAnyFlags(RF_ClassDefaultObject))
+			{
+				It->BenchmarkSettingsForFilter(Iterations, SearchText);
+			}
+		}
+	}));
+#endif
+
+UGameSetting* UGameSettingRegistry::FindSettingByDevName(const FName& SettingDevName)
+{
+	if (const TObjectPtr<UGameSetting>* FoundSetting = RegisteredSettingsByDevName.Find(SettingDevName))
+	{
+		return BuildLazySetting(*FoundSetting);
+	}
+
+	// The snapshot knows which lazy setting it's under, so that's the only one that needs building.
+	if (HasSnapshot())
+	{
+		const FName TopLevelDevName = Snapshot.FindTopLevelDevName(SettingDevName);
+		if (const TObjectPtr<UGameSetting>* TopLevelSetting = RegisteredSettingsByDevName.Find(TopLevelDevName))
+		{
+			BuildLazySetting(*TopLevelSetting);
+
+			if (const TObjectPtr<UGameSetting>* FoundSetting = RegisteredSettingsByDevName.Find(SettingDevName))
+			{
+				return *FoundSetting;
+			}
+		}
+	}
+
+	// Only the lazy setting that declared the DevName is built, a miss never builds the rest.
+	if (const FName* LazyDevName = LazySettingsByInnerDevName.Find(SettingDevName))
+	{
+		if (const TObjectPtr<UGameSetting>* LazySetting = RegisteredSettingsByDevName.Find(*LazyDevName))
+		{
+			BuildLazySetting(*LazySetting);
+
+			if (const TObjectPtr<UGameSetting>* FoundSetting = RegisteredSettingsByDevName.Find(SettingDevName))
+			{
+				return *FoundSetting;
+			}
+		}
+	}
+
+	return nullptr;
 }
 
-void UGameSettingRegistry::Initialize(ULocalPlayer* InLocalPlayer)
+void UGameSettingRegistry::RegisterSetting(UGameSetting* InSetting)
 {
-	OwningLocalPlayer = InLocalPlayer;
-	OnInitialize(InLocalPlayer);
+	if (InSetting)
+	{
+		InSetting = ReuseExistingSettings(InSetting);
 
-	//UGameFeaturesSubsystem
+		TopLevelSettings.Add(InSetting);
+		InSetting->SetRegistry(this);
+		RegisterInnerSettings(InSetting);
+	}
 }
 
-void UGameSettingRegistry::Regenerate()
+void UGameSettingRegistry::RegisterAddedSetting(UGameSetting* InSetting)
 {
-	for (UGameSetting* Setting : RegisteredSettings)
+	// Registering bumps the structure version, so the setting tree and cached filter results pick it up.
+	RegisterInnerSettings(InSetting);
+}
+
+void UGameSettingRegistry::RegisterLazySetting(const FName& InDevName, const FText& InDisplayName, const FBuildGameSetting& InBuilder, TConstArrayView<FName> InInnerDevNames)
+{
+	check(InBuilder.IsBound());
+
+#if !UE_BUILD_SHIPPING
+	ensureAlwaysMsgf(!RegisteredSettingsByDevName.Contains(InDevName), TEXT("A setting with this DevName has already been registered!  DevNames must be unique within a registry."));
+#endif
+
+	UGameSettingCollection* Stub = NewObject<UGameSettingCollection>(this);
+	Stub->SetDevName(InDevName);
+	Stub->SetDisplayName(InDisplayName);
+	Stub->SetRegistry(this);
+
+	TopLevelSettings.Add(Stub);
+	RegisteredSettingsByDevName.Add(InDevName, Stub);
+	LazySettingBuilders.Add(InDevName, InBuilder);
+	StructureVersion++;
+
+	for (const FName& InnerDevName : InInnerDevNames)
 	{
-		Setting->MarkAsGarbage();
+		LazySettingsByInnerDevName.Add(InnerDevName, InDevName);
 	}
-	RegisteredSettings.Reset();
-	TopLevelSettings.Reset();
 
-	OnInitialize(OwningLocalPlayer);
+	// Settings that were already built before an incremental regenerate are rebuilt right away so they can be reused.
+	if (ReusableSettings.Contains(InDevName))
+	{
+		BuildLazySetting(Stub);
+	}
 }
 
-bool UGameSettingRegistry::IsFinishedInitializing() const
+void UGameSettingRegistry::RegisterDefinition(const UGameSettingRegistryDefinition* InDefinition, bool bBuildOnDemand)
 {
-	bool bReady = true;
-	for (UGameSetting* Setting : RegisteredSettings)
+	if (!ensure(InDefinition))
+	{
+		return;
+	}
+
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_UGameSettingRegistry_RegisterDefinition);
+
+	RegisteredDefinitions.AddUnique(InDefinition);
+
+	auto FindSetting = [this](const FName& InDevName) { return FindSettingByDevName(InDevName); };
+
+	for (const int32 RootIndex : InDefinition->GetRootIndices())
 	{
-		if (!Setting->IsReady())
+		const FGameSettingDefinition& RootDefinition = InDefinition->GetSettings()[RootIndex];
+
+		if (RootDefinition.ParentDevName.IsNone())
 		{
-			bReady = false;
-			break;
+			if (bBuildOnDemand)
+			{
+				TWeakObjectPtr<const UGameSettingRegistryDefinition> WeakDefinition = InDefinition;
+				RegisterLazySetting(RootDefinition.DevName, RootDefinition.DisplayName, FBuildGameSetting::CreateWeakLambda(this, [this, WeakDefinition, RootIndex](ULocalPlayer* LocalPlayer) -> UGameSetting*
+				{
+					const UGameSettingRegistryDefinition* Definition = WeakDefinition.Get();
+					if (!Definition)
+					{
+						return nullptr;
+					}
+
+					UGameSetting* Setting = Definition->BuildSettings(RootIndex, [this](const FName& InDevName) { return FindSettingByDevName(InDevName); });
+					if (Setting)
+					{
+						Setting->Initialize(LocalPlayer);
+					}
+					return Setting;
+				}));
+			}
+			else if (UGameSetting* Setting = InDefinition->BuildSettings(RootIndex, FindSetting))
+			{
+				Setting->Initialize(OwningLocalPlayer);
+				RegisterSetting(Setting);
+			}
+
+			continue;
+		}
+
+		// Skip roots that are already registered, e.g. the same definition registered twice, rather than adding a duplicate DevName.
+		if (RegisteredSettingsByDevName.Contains(RootDefinition.DevName))
+		{
+			continue;
+		}
+
+		if (PendingDefinitionRoots.ContainsByPredicate([InDefinition, RootIndex](const FPendingDefinitionRoot& Pending) { return Pending.Definition == InDefinition && Pending.RootIndex == RootIndex; }))
+		{
+			continue;
 		}
+
+		// Looking the parent up would build the lazy setting it's in, so the root waits for that to be built instead.
+		const FName LazyDevName = FindPendingLazySetting(RootDefinition.ParentDevName);
+		if (!LazyDevName.IsNone())
+		{
+			PendingDefinitionRoots.Add({ InDefinition, RootIndex });
+			LazySettingsByInnerDevName.Add(RootDefinition.DevName, LazyDevName);
+			continue;
+		}
+
+		UGameSettingCollection* ParentCollection = Cast<UGameSettingCollection>(RegisteredSettingsByDevName.FindRef(RootDefinition.ParentDevName));
+		if (!ensureMsgf(ParentCollection, TEXT("%s: %s goes in %s, which isn't a registered collection."), *InDefinition->GetPathName(), *RootDefinition.DevName.ToString(), *RootDefinition.ParentDevName.ToString()))
+		{
+			continue;
+		}
+
+		AddDefinitionRoot(InDefinition, RootIndex, ParentCollection);
 	}
+}
 
-	return bReady;
+void UGameSettingRegistry::AddDefinitionRoot(const UGameSettingRegistryDefinition* InDefinition, int32 RootIndex, UGameSettingCollection* InParentCollection)
+{
+	if (UGameSetting* Setting = InDefinition->BuildSettings(RootIndex, [this](const FName& InDevName) { return FindSettingByDevName(InDevName); }))
+	{
+		// Adding it initializes and registers it, since the collection already is both.
+		InParentCollection->AddSetting(Setting);
+	}
 }
 
-void UGameSettingRegistry::SaveChanges()
+void UGameSettingRegistry::AddPendingDefinitionRoots()
 {
+	// Roots can go in other deferred roots, so keep going until a pass adds nothing.
+	bool bAddedRoot = true;
+	while (bAddedRoot)
+	{
+		bAddedRoot = false;
+
+		for (int32 PendingIdx = 0; PendingIdx < PendingDefinitionRoots.Num(); ++PendingIdx)
+		{
+			const FPendingDefinitionRoot Pending = PendingDefinitionRoots[PendingIdx];
+			const UGameSettingRegistryDefinition* Definition = Pending.Definition.Get();
+			if (!Definition)
+			{
+				PendingDefinitionRoots.RemoveAt(PendingIdx--);
+				continue;
+			}
+
+			const FName ParentDevName = Definition->GetSettings()[Pending.RootIndex].ParentDevName;
+			UGameSettingCollection* ParentCollection = Cast<UGameSettingCollection>(RegisteredSettingsByDevName.FindRef(ParentDevName));
+			if (ParentCollection && !IsLazySettingPending(ParentCollection))
+			{
+				PendingDefinitionRoots.RemoveAt(PendingIdx--);
+				AddDefinitionRoot(Definition, Pending.RootIndex, ParentCollection);
+				bAddedRoot = true;
+			}
+		}
+	}
 
+	// Whatever is left either waits on a lazy setting that still isn't built, or will never find its parent.
+	for (int32 PendingIdx = 0; PendingIdx < PendingDefinitionRoots.Num(); ++PendingIdx)
+	{
+		const FPendingDefinitionRoot& Pending = PendingDefinitionRoots[PendingIdx];
+		const FGameSettingDefinition& RootDefinition = Pending.Definition->GetSettings()[Pending.RootIndex];
+		if (!ensureMsgf(!FindPendingLazySetting(RootDefinition.ParentDevName).IsNone(), TEXT("%s: %s goes in %s, which its lazy setting didn't build as a collection."), *Pending.Definition->GetPathName(), *RootDefinition.DevName.ToString(), *RootDefinition.ParentDevName.ToString()))
+		{
+			PendingDefinitionRoots.RemoveAt(PendingIdx--);
+		}
+	}
 }
 
-void UGameSettingRegistry::GetSettingsForFilter(const FGameSettingFilterState& FilterState, TArray<UGameSetting*>& InOutSettings)
+FName UGameSettingRegistry::FindPendingLazySetting(const FName& InDevName) const
 {
-	TArray<UGameSetting*> RootSettings;
-	if (FilterState.GetSettingRootList().Num() > 0)
+	if (const TObjectPtr<UGameSetting>* FoundSetting = RegisteredSettingsByDevName.Find(InDevName))
 	{
-		RootSettings.Append(FilterState.GetSettingRootList());
+		return IsLazySettingPending(*FoundSetting) ? InDevName : NAME_None;
 	}
-	else
+
+	const FName* LazyDevName = LazySettingsByInnerDevName.Find(InDevName);
+	if (LazyDevName && IsLazySettingPending(RegisteredSettingsByDevName.FindRef(*LazyDevName)))
 	{
-		RootSettings.Append(TopLevelSettings);
+		return *LazyDevName;
 	}
 
-	for (UGameSetting* TopLevelSetting : RootSettings)
+	if (HasSnapshot())
 	{
-		if (const UGameSettingCollection* TopLevelCollection = Cast<UGameSettingCollection>(TopLevelSetting))
-		{
-			TopLevelCollection->GetSettingsForFilter(FilterState, InOutSettings);
-		}
-		else
+		const FName TopLevelDevName = Snapshot.FindTopLevelDevName(InDevName);
+		if (IsLazySettingPending(RegisteredSettingsByDevName.FindRef(TopLevelDevName)))
 		{
-			if (FilterState.DoesSettingPassFilter(*TopLevelSetting))
-			{
-				InOutSettings.Add(TopLevelSetting);
-			}
+			return TopLevelDevName;
 		}
 	}
+
+	return NAME_None;
 }
 
-UGameSetting* UGameSettingRegistry::FindSettingByDevName(const FName& SettingDevName)
+void UGameSettingRegistry::BuildAllLazySettings()
 {
-	for (UGameSetting* Setting : RegisteredSettings)
+	for (int32 SettingIdx = 0; SettingIdx < TopLevelSettings.Num(); ++SettingIdx)
+	{
+		BuildLazySetting(TopLevelSettings[SettingIdx]);
+	}
+}
+
+UGameSetting* UGameSettingRegistry::BuildLazySetting(UGameSetting* InStub)
+{
+	if (!IsLazySettingPending(InStub))
+	{
+		return InStub;
+	}
+
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_UGameSettingRegistry_BuildLazySetting);
+
+	// The built setting's providers are fetched once it's registered.
+	FGameSettingStartupBatchScope StartupBatch(*StartupScheduler, OwningLocalPlayer);
+
+	const FName DevName = InStub->GetDevName();
+	const FBuildGameSetting Builder = LazySettingBuilders.FindAndRemoveChecked(DevName);
+	RegisteredSettingsByDevName.Remove(DevName);
+
+	UGameSetting* Setting = Builder.Execute(OwningLocalPlayer);
+	if (!ensureMsgf(Setting && Setting->GetDevName() == DevName, TEXT("Lazy setting %s built a setting with a different DevName."), *DevName.ToString()))
+	{
+		TopLevelSettings.Remove(InStub);
+		StructureVersion++;
+		AddPendingDefinitionRoots();
+		return nullptr;
+	}
+
+	Setting = ReuseExistingSettings(Setting);
+
+	// Take the stand in's place, so the top level order is the same as if it had been registered up front.
+	TopLevelSettings[TopLevelSettings.IndexOfByKey(InStub)] = Setting;
+	InStub->MarkAsGarbage();
+
+	const int32 FirstBuiltSettingIndex = RegisteredSettings.Num();
+	Setting->SetRegistry(this);
+	RegisterInnerSettings(Setting);
+
+	AddPendingDefinitionRoots();
+
+	// The warm-up pass only covered the settings that were registered when it ran.
+	if (IsFinishedInitializing())
+	{
+		StartPlainTextWarmup(FirstBuiltSettingIndex);
+	}
+
+	for (auto It = LazySettingsByInnerDevName.CreateIterator(); It; ++It)
 	{
-		if (Setting->GetDevName() == SettingDevName)
+		if (It.Value() == DevName)
 		{
-			return Setting;
+#if !UE_BUILD_SHIPPING
+			ensureMsgf(RegisteredSettingsByDevName.Contains(It.Key()), TEXT("Lazy setting %s declared %s, but didn't build it."), *DevName.ToString(), *It.Key().ToString());
+#endif
+			It.RemoveCurrent();
 		}
 	}
 
-	return nullptr;
+	UpdateSnapshotIfComplete();
+
+	return Setting;
 }
 
-void UGameSettingRegistry::RegisterSetting(UGameSetting* InSetting)
+FString UGameSettingRegistry::GetSnapshotFilename() const
 {
-	if (InSetting)
+	return FPaths::ProjectSavedDir() / TEXT("GameSettings") / GetClass()->GetName() + TEXT(".snapshot");
+}
+
+#if !UE_BUILD_SHIPPING
+void UGameSettingRegistry::SaveSnapshot()
+{
+	// It's written below, building the last lazy setting doesn't need to as well.
+	bSnapshotUpToDate = true;
+	BuildAllLazySettings();
+
+	WriteSnapshot();
+}
+
+void UGameSettingRegistry::WriteSnapshot()
+{
+	bSnapshotUpToDate = true;
+	Snapshot.Capture(TopLevelSettings, GetSnapshotDefinitionVersion());
+
+	const FString Filename = GetSnapshotFilename();
+	if (Snapshot.SaveToFile(Filename))
 	{
-		TopLevelSettings.Add(InSetting);
-		InSetting->SetRegistry(this);
-		RegisterInnerSettings(InSetting);
+		UE_LOG(LogGameSettings, Log, TEXT("%s: saved a snapshot of %d settings to %s"), *GetName(), Snapshot.GetEntries().Num(), *Filename);
+	}
+	else
+	{
+		UE_LOG(LogGameSettings, Warning, TEXT("%s: couldn't save the snapshot to %s"), *GetName(), *Filename);
+	}
+}
+#endif
+
+void UGameSettingRegistry::UpdateSnapshotIfComplete()
+{
+#if !UE_BUILD_SHIPPING
+	// Settings built while OnInitialize is still registering them aren't the whole tree yet, and only a tree that has
+	// been built anyway is written, pending lazy settings are never built for it.
+	if (!GameSettingRegistry::bUseRegistrySnapshot || bInOnInitialize || LazySettingBuilders.Num() > 0)
+	{
+		return;
+	}
+
+	if (bSnapshotUpToDate && !GameSettingRegistry::bValidateRegistrySnapshot)
+	{
+		return;
+	}
+
+	if (HasSnapshot())
+	{
+		FGameSettingRegistrySnapshot BuiltSnapshot;
+		BuiltSnapshot.Capture(TopLevelSettings, GetSnapshotDefinitionVersion());
+
+		TArray<FString> Differences;
+		Snapshot.Diff(BuiltSnapshot, Differences);
+		if (Differences.Num() == 0)
+		{
+			bSnapshotUpToDate = true;
+			return;
+		}
+
+		for (const FString& Difference : Differences)
+		{
+			UE_LOG(LogGameSettings, Warning, TEXT("%s: the setting tree differs from its snapshot, %s"), *GetName(), *Difference);
+		}
 	}
+
+	WriteSnapshot();
+#endif
 }
 
 void UGameSettingRegistry::RegisterInnerSettings(UGameSetting* InSetting)
 {
+	// Edit dependencies between settings of the same registry are evaluated through our graph.
+	InSetting->SetRegistry(this);
+
 	InSetting->OnSettingChangedEvent.AddUObject(this, &ThisClass::HandleSettingChanged);
 	InSetting->OnSettingAppliedEvent.AddUObject(this, &ThisClass::HandleSettingApplied);
 	InSetting->OnSettingEditConditionChangedEvent.AddUObject(this, &ThisClass::HandleSettingEditConditionsChanged);
 
+	// Most settings are ready by the time they're registered, only keep track of the ones that aren't.
+	if (!InSetting->IsReady())
+	{
+		NumSettingsPendingStartup++;
+		InSetting->OnSettingReadyEvent.AddUObject(this, &ThisClass::HandleSettingReady);
+	}
+
 	// Not a fan of this, but it makes sense to aggregate action events for simplicity.
 	if (UGameSettingAction* ActionSetting = Cast<UGameSettingAction>(InSetting))
 	{
@@ -126,12 +1075,23 @@ void UGameSettingRegistry::RegisterInnerSettings(UGameSetting* InSetting)
 		NewPageCollection->OnExecuteNavigationEvent.AddUObject(this, &ThisClass::HandleSettingNavigation);
 	}
 
+	const TObjectPtr<UGameSetting>* ExistingSetting = RegisteredSettingsByDevName.Find(InSetting->GetDevName());
+
 #if !UE_BUILD_SHIPPING
-	ensureAlwaysMsgf(!RegisteredSettings.Contains(InSetting), TEXT("This setting has already been registered!"));
-	ensureAlwaysMsgf(nullptr == RegisteredSettings.FindByPredicate([&InSetting](UGameSetting* ExistingSetting) { return InSetting->GetDevName() == ExistingSetting->GetDevName(); }), TEXT("A setting with this DevName has already been registered!  DevNames must be unique within a registry."));
+	ensureAlwaysMsgf(!ExistingSetting || *ExistingSetting != InSetting, TEXT("This setting has already been registered!"));
+	ensureAlwaysMsgf(!ExistingSetting || *ExistingSetting == InSetting, TEXT("A setting with this DevName has already been registered!  DevNames must be unique within a registry."));
 #endif
 
+	// The first setting registered under a DevName wins lookups, matching the old linear search order.
+	if (!ExistingSetting)
+	{
+		RegisteredSettingsByDevName.Add(InSetting->GetDevName(), InSetting);
+	}
+
 	RegisteredSettings.Add(InSetting);
+	bEditDependencyGraphDirty = true;
+	SearchIndex.MarkDirty();
+	StructureVersion++;
 
 	for (UGameSetting* ChildSetting : InSetting->GetChildSettings())
 	{
@@ -139,19 +1099,182 @@ void UGameSettingRegistry::RegisterInnerSettings(UGameSetting* InSetting)
 	}
 }
 
+void UGameSettingRegistry::HandleSettingReady(UGameSetting* Setting)
+{
+	Setting->OnSettingReadyEvent.RemoveAll(this);
+
+	if (ensure(NumSettingsPendingStartup > 0))
+	{
+		NumSettingsPendingStartup--;
+		if (NumSettingsPendingStartup == 0)
+		{
+			BroadcastIfFinishedInitializing();
+		}
+	}
+}
+
 void UGameSettingRegistry::HandleSettingApplied(UGameSetting* Setting)
 {
 	OnSettingApplied(Setting);
 }
 
+void UGameSettingRegistry::BeginChangeBatch()
+{
+	ChangeBatchDepth++;
+}
+
+void UGameSettingRegistry::EndChangeBatch()
+{
+	if (!ensureMsgf(ChangeBatchDepth > 0, TEXT("EndChangeBatch called without a matching BeginChangeBatch.")))
+	{
+		return;
+	}
+
+	// Re-evaluate dependents while still batching, so their changes are folded into the same batch.
+	if (ChangeBatchDepth == 1 && !bEvaluatingEditDependencies)
+	{
+		EvaluateEditDependencies();
+	}
+
+	if (--ChangeBatchDepth > 0)
+	{
+		return;
+	}
+
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_UGameSettingRegistry_EndChangeBatch);
+
+	const TMap<UGameSetting*, EGameSettingChangeReason> SettingChanges = MoveTemp(BatchedSettingChanges);
+	const TSet<UGameSetting*> EditConditionChanges = MoveTemp(BatchedEditConditionChanges);
+	BatchedSettingChanges.Reset();
+	BatchedEditConditionChanges.Reset();
+
+	TArray<UGameSetting*> ChangedSettings;
+	ChangedSettings.Reserve(SettingChanges.Num());
+
+	for (const TPair<UGameSetting*, EGameSettingChangeReason>& SettingChange : SettingChanges)
+	{
+		OnSettingChangedEvent.Broadcast(SettingChange.Key, SettingChange.Value);
+		ChangedSettings.Add(SettingChange.Key);
+	}
+
+	for (UGameSetting* Setting : EditConditionChanges)
+	{
+		OnSettingEditConditionChangedEvent.Broadcast(Setting);
+	}
+
+	OnChangeBatchEndedEvent.Broadcast(ChangedSettings);
+}
+
 void UGameSettingRegistry::HandleSettingChanged(UGameSetting* Setting, EGameSettingChangeReason Reason)
 {
-	OnSettingChangedEvent.Broadcast(Setting, Reason);
+	if (ChangeBatchDepth > 0)
+	{
+		// Keep the reason the setting was changed for, rather than the dependency changes that followed.
+		EGameSettingChangeReason& BatchedReason = BatchedSettingChanges.FindOrAdd(Setting, Reason);
+		if (Reason != EGameSettingChangeReason::DependencyChanged)
+		{
+			BatchedReason = Reason;
+		}
+	}
+	else
+	{
+		OnSettingChangedEvent.Broadcast(Setting, Reason);
+	}
+
+	// Dependents announce their own change as DependencyChanged, anything depending on them is already in the same pass.
+	if (Reason != EGameSettingChangeReason::DependencyChanged)
+	{
+		QueueEditDependencyChange(Setting, true);
+	}
 }
 
 void UGameSettingRegistry::HandleSettingEditConditionsChanged(UGameSetting* Setting)
 {
-	OnSettingEditConditionChangedEvent.Broadcast(Setting);
+	if (ChangeBatchDepth > 0)
+	{
+		BatchedEditConditionChanges.Add(Setting);
+	}
+	else
+	{
+		OnSettingEditConditionChangedEvent.Broadcast(Setting);
+	}
+
+	QueueEditDependencyChange(Setting, false);
+}
+
+void UGameSettingRegistry::QueueEditDependencyChange(UGameSetting* InSetting, bool bValueChanged)
+{
+	if (bEditDependencyGraphDirty)
+	{
+		EditDependencyGraph.Compile(RegisteredSettings);
+		bEditDependencyGraphDirty = false;
+	}
+
+	if (!EditDependencyGraph.HasDependents(InSetting) || SettingsInEditDependencyPass.Contains(InSetting))
+	{
+		return;
+	}
+
+	if (TPair<UGameSetting*, bool>* PendingChange = PendingEditDependencyChanges.FindByPredicate([InSetting](const TPair<UGameSetting*, bool>& Change) { return Change.Key == InSetting; }))
+	{
+		PendingChange->Value |= bValueChanged;
+	}
+	else
+	{
+		PendingEditDependencyChanges.Emplace(InSetting, bValueChanged);
+	}
+
+	// Batches re-evaluate every dependent once when they end.
+	if (!bEvaluatingEditDependencies && ChangeBatchDepth == 0)
+	{
+		EvaluateEditDependencies();
+	}
+}
+
+void UGameSettingRegistry::EvaluateEditDependencies()
+{
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_UGameSettingRegistry_EvaluateEditDependencies);
+
+	TGuardValue<bool> Guard(bEvaluatingEditDependencies, true);
+
+	for (int32 Pass = 0; PendingEditDependencyChanges.Num() > 0; ++Pass)
+	{
+		if (!ensureMsgf(Pass < GameSettingRegistry::MaxEditDependencyPasses, TEXT("Edit dependencies are still changing after %d passes, giving up."), Pass))
+		{
+			PendingEditDependencyChanges.Reset();
+			break;
+		}
+
+		TArray<UGameSetting*> ChangedSettings;
+		TSet<UGameSetting*> ValueChangedSettings;
+		for (const TPair<UGameSetting*, bool>& Change : PendingEditDependencyChanges)
+		{
+			ChangedSettings.Add(Change.Key);
+			if (Change.Value)
+			{
+				ValueChangedSettings.Add(Change.Key);
+			}
+		}
+		PendingEditDependencyChanges.Reset();
+
+		TArray<UGameSetting*> AffectedSettings;
+		EditDependencyGraph.GatherAffectedSettings(ChangedSettings, AffectedSettings);
+
+		SettingsInEditDependencyPass.Append(ChangedSettings);
+		SettingsInEditDependencyPass.Append(AffectedSettings);
+
+		for (UGameSetting* Setting : AffectedSettings)
+		{
+			const bool bDependsOnChangedValue = Setting->GetEditDependencies().ContainsByPredicate([&ValueChangedSettings](UGameSetting* DependencySetting)
+			{
+				return ValueChangedSettings.Contains(DependencySetting);
+			});
+
+			Setting->HandleEditDependenciesChanged(bDependsOnChangedValue);
+		}
+
+		SettingsInEditDependencyPass.Reset();
+	}
 }
 
 void UGameSettingRegistry::HandleSettingNamedAction(UGameSetting* Setting, FGameplayTag GameSettings_Action_Tag)
@@ -2,11 +2,14 @@
 
 #include "GameSettingRegistryChangeTracker.h"
 
+#include "GameSettingProfiling.h"
 #include "GameSettingRegistry.h"
 #include "GameSettingValue.h"
 
 #define LOCTEXT_NAMESPACE "GameSetting"
 
+DECLARE_CYCLE_STAT(TEXT("ChangeTracker ApplyChanges"), STAT_GameSettingRegistryChangeTracker_ApplyChanges, STATGROUP_GameSettings);
+
 FGameSettingRegistryChangeTracker::FGameSettingRegistryChangeTracker()
 {
 }
@@ -52,8 +55,37 @@ void FGameSettingRegistryChangeTracker::ClearDirtyState()
 	DirtySettings.Reset();
 }
 
-void FGameSettingRegistryChangeTracker::ApplyChanges()
+FGameSettingApplyCategories FGameSettingRegistryChangeTracker::GetDirtyApplyCategories() const
 {
+	FGameSettingApplyCategories DirtyCategories;
+
+	for (const auto& Entry : DirtySettings)
+	{
+		if (const UGameSetting* Setting = Entry.Value.Get())
+		{
+			const TConstArrayView<FName> ApplyCategories = Setting->FindEffectiveApplyCategories();
+			if (ApplyCategories.Num() == 0)
+			{
+				// We don't know what this setting touches.
+				return FGameSettingApplyCategories::All();
+			}
+
+			for (const FName& ApplyCategory : ApplyCategories)
+			{
+				DirtyCategories.Add(ApplyCategory);
+			}
+		}
+	}
+
+	return DirtyCategories;
+}
+
+FGameSettingApplyCategories FGameSettingRegistryChangeTracker::ApplyChanges()
+{
+	SCOPE_CYCLE_COUNTER(STAT_GameSettingRegistryChangeTracker_ApplyChanges);
+
+	const FGameSettingApplyCategories DirtyCategories = GetDirtyApplyCategories();
+
 	for (auto Entry : DirtySettings)
 	{
 		if (UGameSettingValue* SettingValue = Cast<UGameSettingValue>(Entry.Value))
@@ -64,6 +96,8 @@ void FGameSettingRegistryChangeTracker::ApplyChanges()
 	}
 
 	ClearDirtyState();
+
+	return DirtyCategories;
 }
 
 void FGameSettingRegistryChangeTracker::RestoreToInitial()
@@ -76,6 +110,8 @@ void FGameSettingRegistryChangeTracker::RestoreToInitial()
 
 	{
 		TGuardValue<bool> LocalGuard(bRestoringSettings, true);
+		FGameSettingRegistryChangeBatchScope ChangeBatch(Registry.Get());
+
 		for (auto Entry : DirtySettings)
 		{
 			if (UGameSettingValue* SettingValue = Cast<UGameSettingValue>(Entry.Value))
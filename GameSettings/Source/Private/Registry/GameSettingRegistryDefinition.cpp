@@ -0,0 +1,334 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "GameSettingRegistryDefinition.h"
+
+#include "DataSource/GameSettingDataSourceDynamic.h"
+#include "EditCondition/WhenPlatformHasTrait.h"
+#include "EditCondition/WhenPlayingAsPrimaryPlayer.h"
+#include "GameSettingCollection.h"
+#include "GameSettingValueDiscreteDynamic.h"
+#include "GameSettingValueScalarDynamic.h"
+#include "UObject/Package.h"
+
+#if WITH_EDITOR
+#include "Misc/DataValidation.h"
+#endif
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(GameSettingRegistryDefinition)
+
+#define LOCTEXT_NAMESPACE "GameSetting"
+
+namespace GameSettingRegistryDefinition
+{
+	static TSharedRef<FGameSettingDataSource> MakeDataSource(const FString& InPath)
+	{
+		TArray<FString> PathParts;
+		InPath.ParseIntoArray(PathParts, TEXT("."));
+		return MakeShared<FGameSettingDataSourceDynamic>(PathParts);
+	}
+
+	static FSettingScalarFormatFunction GetScalarFormat(EGameSettingScalarFormat InFormat)
+	{
+		switch (InFormat)
+		{
+		case EGameSettingScalarFormat::Raw:							return UGameSettingValueScalarDynamic::Raw;
+		case EGameSettingScalarFormat::RawOneDecimal:				return UGameSettingValueScalarDynamic::RawOneDecimal;
+		case EGameSettingScalarFormat::RawTwoDecimals:				return UGameSettingValueScalarDynamic::RawTwoDecimals;
+		case EGameSettingScalarFormat::ZeroToOnePercent:			return UGameSettingValueScalarDynamic::ZeroToOnePercent;
+		case EGameSettingScalarFormat::ZeroToOnePercent_OneDecimal:	return UGameSettingValueScalarDynamic::ZeroToOnePercent_OneDecimal;
+		case EGameSettingScalarFormat::SourceAsPercent1:			return UGameSettingValueScalarDynamic::SourceAsPercent1;
+		case EGameSettingScalarFormat::SourceAsPercent100:			return UGameSettingValueScalarDynamic::SourceAsPercent100;
+		case EGameSettingScalarFormat::SourceAsInteger:				return UGameSettingValueScalarDynamic::SourceAsInteger;
+		}
+
+		return UGameSettingValueScalarDynamic::Raw;
+	}
+}
+
+//--------------------------------------
+// UGameSettingRegistryDefinition
+//--------------------------------------
+
+void UGameSettingRegistryDefinition::PostLoad()
+{
+	Super::PostLoad();
+
+	// Cooked definitions were resolved when they were saved, uncooked ones may have been edited since.
+	if (!FPlatformProperties::RequiresCookedData() || ParentIndices.Num() != Settings.Num())
+	{
+		RebuildLookupTables();
+	}
+}
+
+void UGameSettingRegistryDefinition::PreSave(FObjectPreSaveContext SaveContext)
+{
+	Super::PreSave(SaveContext);
+
+	RebuildLookupTables();
+}
+
+#if WITH_EDITOR
+void UGameSettingRegistryDefinition::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	RebuildLookupTables();
+}
+
+EDataValidationResult UGameSettingRegistryDefinition::IsDataValid(FDataValidationContext& Context) const
+{
+	EDataValidationResult Result = CombineDataValidationResults(Super::IsDataValid(Context), EDataValidationResult::Valid);
+
+	TMap<FName, int32> IndicesByDevName;
+	for (int32 SettingIndex = 0; SettingIndex < Settings.Num(); ++SettingIndex)
+	{
+		const FGameSettingDefinition& Definition = Settings[SettingIndex];
+		const FText DevNameText = FText::FromName(Definition.DevName);
+
+		if (Definition.DevName.IsNone())
+		{
+			Context.AddError(FText::Format(LOCTEXT("DefinitionMissingDevName", "Setting {0} doesn't have a DevName."), SettingIndex));
+			Result = EDataValidationResult::Invalid;
+		}
+		else if (IndicesByDevName.Contains(Definition.DevName))
+		{
+			Context.AddError(FText::Format(LOCTEXT("DefinitionDuplicateDevName", "{0} is used by more than one setting, DevNames must be unique within a registry."), DevNameText));
+			Result = EDataValidationResult::Invalid;
+		}
+
+		if (!Definition.SettingClass || Definition.SettingClass->HasAnyClassFlags(CLASS_Abstract))
+		{
+			Context.AddError(FText::Format(LOCTEXT("DefinitionMissingClass", "{0} needs a setting class that isn't abstract."), DevNameText));
+			Result = EDataValidationResult::Invalid;
+		}
+
+		if (Definition.DisplayName.IsEmpty())
+		{
+			Context.AddError(FText::Format(LOCTEXT("DefinitionMissingDisplayName", "{0} needs a DisplayName."), DevNameText));
+			Result = EDataValidationResult::Invalid;
+		}
+
+		if (Definition.ParentDevName.IsNone())
+		{
+			// A top level setting.
+		}
+		else if (const int32* ParentIndex = IndicesByDevName.Find(Definition.ParentDevName))
+		{
+			const TSubclassOf<UGameSetting> ParentClass = Settings[*ParentIndex].SettingClass;
+			if (!ParentClass || !ParentClass->IsChildOf<UGameSettingCollection>())
+			{
+				Context.AddError(FText::Format(LOCTEXT("DefinitionParentNotCollection", "{0} is in {1}, which isn't a collection."), DevNameText, FText::FromName(Definition.ParentDevName)));
+				Result = EDataValidationResult::Invalid;
+			}
+		}
+		else if (Settings.ContainsByPredicate([&Definition](const FGameSettingDefinition& Other) { return Other.DevName == Definition.ParentDevName; }))
+		{
+			Context.AddError(FText::Format(LOCTEXT("DefinitionParentAfterChild", "{0} is listed before its parent {1}, parents must come first."), DevNameText, FText::FromName(Definition.ParentDevName)));
+			Result = EDataValidationResult::Invalid;
+		}
+
+		IndicesByDevName.FindOrAdd(Definition.DevName, SettingIndex);
+	}
+
+	return Result;
+}
+#endif
+
+void UGameSettingRegistryDefinition::RebuildLookupTables()
+{
+	ParentIndices.Reset(Settings.Num());
+	RootIndices.Reset();
+
+	// Parents come first, so a setting's parent is always one of the settings before it.
+	TMap<FName, int32> IndicesByDevName;
+	IndicesByDevName.Reserve(Settings.Num());
+
+	for (int32 SettingIndex = 0; SettingIndex < Settings.Num(); ++SettingIndex)
+	{
+		const FGameSettingDefinition& Definition = Settings[SettingIndex];
+
+		const int32 ParentIndex = Definition.ParentDevName.IsNone() ? INDEX_NONE : IndicesByDevName.FindRef(Definition.ParentDevName, INDEX_NONE);
+		ParentIndices.Add(ParentIndex);
+
+		if (ParentIndex == INDEX_NONE)
+		{
+			RootIndices.Add(SettingIndex);
+		}
+
+		IndicesByDevName.FindOrAdd(Definition.DevName, SettingIndex);
+	}
+}
+
+UGameSetting* UGameSettingRegistryDefinition::BuildSettings(int32 RootIndex, TFunctionRef<UGameSetting*(const FName&)> FindSetting) const
+{
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_UGameSettingRegistryDefinition_BuildSettings);
+
+	if (!ensure(Settings.IsValidIndex(RootIndex) && ParentIndices.Num() == Settings.Num()))
+	{
+		return nullptr;
+	}
+
+	TArray<UGameSetting*> BuiltSettings;
+	BuiltSettings.SetNumZeroed(Settings.Num());
+
+	UGameSetting* RootSetting = BuildSetting(Settings[RootIndex]);
+	BuiltSettings[RootIndex] = RootSetting;
+
+	// Parents come first, so everything under the root is built in a single pass after it.
+	for (int32 SettingIndex = RootIndex + 1; RootSetting && SettingIndex < Settings.Num(); ++SettingIndex)
+	{
+		const int32 ParentIndex = ParentIndices[SettingIndex];
+		if (ParentIndex == INDEX_NONE || BuiltSettings[ParentIndex] == nullptr)
+		{
+			continue;
+		}
+
+		UGameSettingCollection* ParentCollection = Cast<UGameSettingCollection>(BuiltSettings[ParentIndex]);
+		if (!ensureMsgf(ParentCollection, TEXT("%s: %s isn't a collection, so %s can't go in it."), *GetPathName(), *Settings[ParentIndex].DevName.ToString(), *Settings[SettingIndex].DevName.ToString()))
+		{
+			continue;
+		}
+
+		if (UGameSetting* Setting = BuildSetting(Settings[SettingIndex]))
+		{
+			ParentCollection->AddSetting(Setting);
+			BuiltSettings[SettingIndex] = Setting;
+		}
+	}
+
+	// Dependencies can be on any setting, so they're added once the whole subtree exists.
+	TMap<FName, UGameSetting*> SubtreeSettings;
+	for (UGameSetting* Setting : BuiltSettings)
+	{
+		if (Setting)
+		{
+			SubtreeSettings.Add(Setting->GetDevName(), Setting);
+		}
+	}
+
+	for (int32 SettingIndex = RootIndex; SettingIndex < Settings.Num(); ++SettingIndex)
+	{
+		UGameSetting* Setting = BuiltSettings[SettingIndex];
+		if (!Setting)
+		{
+			continue;
+		}
+
+		for (const FName& DependencyDevName : Settings[SettingIndex].EditDependencies)
+		{
+			UGameSetting* DependencySetting = SubtreeSettings.FindRef(DependencyDevName);
+			if (!DependencySetting)
+			{
+				DependencySetting = FindSetting(DependencyDevName);
+			}
+
+			if (ensureMsgf(DependencySetting, TEXT("%s: %s depends on %s, which doesn't exist."), *GetPathName(), *Setting->GetDevName().ToString(), *DependencyDevName.ToString()))
+			{
+				Setting->AddEditDependency(DependencySetting);
+			}
+		}
+	}
+
+	return RootSetting;
+}
+
+UGameSetting* UGameSettingRegistryDefinition::BuildSetting(const FGameSettingDefinition& Definition) const
+{
+	if (!ensureMsgf(Definition.SettingClass && !Definition.SettingClass->HasAnyClassFlags(CLASS_Abstract), TEXT("%s: %s needs a setting class that isn't abstract."), *GetPathName(), *Definition.DevName.ToString()))
+	{
+		return nullptr;
+	}
+
+	UGameSetting* Setting = NewObject<UGameSetting>(GetTransientPackage(), Definition.SettingClass);
+	Setting->SetDevName(Definition.DevName);
+	Setting->SetDisplayName(Definition.DisplayName);
+
+	if (!Definition.DescriptionRichText.IsEmpty())
+	{
+		Setting->SetDescriptionRichText(Definition.DescriptionRichText);
+	}
+
+	for (const FName& ApplyCategory : Definition.ApplyCategories)
+	{
+		Setting->AddApplyCategory(ApplyCategory);
+	}
+
+	if (UGameSettingValueDiscreteDynamic* DiscreteSetting = Cast<UGameSettingValueDiscreteDynamic>(Setting))
+	{
+		if (!Definition.GetterPath.IsEmpty())
+		{
+			DiscreteSetting->SetDynamicGetter(GameSettingRegistryDefinition::MakeDataSource(Definition.GetterPath));
+		}
+
+		if (!Definition.SetterPath.IsEmpty())
+		{
+			DiscreteSetting->SetDynamicSetter(GameSettingRegistryDefinition::MakeDataSource(Definition.SetterPath));
+		}
+
+		// Options the setting class already added are moved to the end with the new text, like SetTrueText does.
+		for (const FGameSettingOptionDefinition& Option : Definition.Options)
+		{
+			if (DiscreteSetting->HasDynamicOption(Option.Value))
+			{
+				DiscreteSetting->RemoveDynamicOption(Option.Value);
+			}
+
+			DiscreteSetting->AddDynamicOption(Option.Value, Option.DisplayText);
+		}
+
+		if (!Definition.DefaultValue.IsEmpty())
+		{
+			DiscreteSetting->SetDefaultValueFromString(Definition.DefaultValue);
+		}
+	}
+	else if (UGameSettingValueScalarDynamic* ScalarSetting = Cast<UGameSettingValueScalarDynamic>(Setting))
+	{
+		if (!Definition.GetterPath.IsEmpty())
+		{
+			ScalarSetting->SetDynamicGetter(GameSettingRegistryDefinition::MakeDataSource(Definition.GetterPath));
+		}
+
+		if (!Definition.SetterPath.IsEmpty())
+		{
+			ScalarSetting->SetDynamicSetter(GameSettingRegistryDefinition::MakeDataSource(Definition.SetterPath));
+		}
+
+		ScalarSetting->SetSourceRangeAndStep(TRange<double>(Definition.ScalarMinimum, Definition.ScalarMaximum), Definition.ScalarStep);
+		ScalarSetting->SetDisplayFormat(GameSettingRegistryDefinition::GetScalarFormat(Definition.ScalarFormat));
+
+		if (!Definition.DefaultValue.IsEmpty())
+		{
+			double DefaultValue = 0.0;
+			LexFromString(DefaultValue, *Definition.DefaultValue);
+			ScalarSetting->SetDefaultValue(DefaultValue);
+		}
+	}
+
+	if (Definition.bPrimaryPlayerOnly)
+	{
+		Setting->AddEditCondition(FWhenPlayingAsPrimaryPlayer::Get());
+	}
+
+	for (const FGameSettingPlatformTraitConditionDefinition& Condition : Definition.PlatformTraitConditions)
+	{
+		switch (Condition.Condition)
+		{
+		case EGameSettingPlatformTraitCondition::KillIfMissing:
+			Setting->AddEditCondition(FWhenPlatformHasTrait::KillIfMissing(Condition.PlatformTrait, Condition.Reason.ToString()));
+			break;
+		case EGameSettingPlatformTraitCondition::DisableIfMissing:
+			Setting->AddEditCondition(FWhenPlatformHasTrait::DisableIfMissing(Condition.PlatformTrait, Condition.Reason));
+			break;
+		case EGameSettingPlatformTraitCondition::KillIfPresent:
+			Setting->AddEditCondition(FWhenPlatformHasTrait::KillIfPresent(Condition.PlatformTrait, Condition.Reason.ToString()));
+			break;
+		case EGameSettingPlatformTraitCondition::DisableIfPresent:
+			Setting->AddEditCondition(FWhenPlatformHasTrait::DisableIfPresent(Condition.PlatformTrait, Condition.Reason));
+			break;
+		}
+	}
+
+	return Setting;
+}
+
+#undef LOCTEXT_NAMESPACE
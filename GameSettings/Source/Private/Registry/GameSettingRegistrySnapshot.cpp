@@ -0,0 +1,264 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "GameSettingRegistrySnapshot.h"
+
+#include "GameSetting.h"
+#include "GameSettingValueDiscreteDynamic.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace GameSettingRegistrySnapshot
+{
+	static constexpr uint32 Magic = 0x47535253; // 'GSRS'
+
+	/** Bump whenever the layout of the snapshot changes, older snapshots are discarded. */
+	static constexpr uint32 FormatVersion = 1;
+}
+
+FArchive& operator<<(FArchive& Ar, FGameSettingRegistrySnapshot::FEntry& Entry)
+{
+	Ar << Entry.DevName;
+	Ar << Entry.ClassPath;
+	Ar << Entry.ParentIndex;
+	Ar << Entry.OptionValues;
+	Ar << Entry.EditConditions;
+	Ar << Entry.EditDependencies;
+	return Ar;
+}
+
+//--------------------------------------
+// FGameSettingRegistrySnapshot
+//--------------------------------------
+
+void FGameSettingRegistrySnapshot::Capture(TConstArrayView<TObjectPtr<UGameSetting>> InTopLevelSettings, uint32 InDefinitionVersion)
+{
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_FGameSettingRegistrySnapshot_Capture);
+
+	Reset();
+	DefinitionVersion = InDefinitionVersion;
+
+	for (UGameSetting* TopLevelSetting : InTopLevelSettings)
+	{
+		AddSubtree(TopLevelSetting, INDEX_NONE);
+	}
+
+	RebuildEntryIndices();
+}
+
+void FGameSettingRegistrySnapshot::AddSubtree(UGameSetting* InSetting, int32 InParentIndex)
+{
+	const int32 EntryIndex = Entries.AddDefaulted();
+	{
+		FEntry& Entry = Entries[EntryIndex];
+		Entry.DevName = InSetting->GetDevName();
+		Entry.ClassPath = InSetting->GetClass()->GetPathName();
+		Entry.ParentIndex = InParentIndex;
+
+		if (UGameSettingValueDiscreteDynamic* DynamicSetting = Cast<UGameSettingValueDiscreteDynamic>(InSetting))
+		{
+			Entry.OptionValues = DynamicSetting->GetDynamicOptions();
+		}
+
+		for (const TSharedRef<FGameSettingEditCondition>& EditCondition : InSetting->GetEditConditions())
+		{
+			Entry.EditConditions.Add(EditCondition->ToString());
+		}
+
+		for (const UGameSetting* DependencySetting : InSetting->GetEditDependencies())
+		{
+			Entry.EditDependencies.Add(DependencySetting ? DependencySetting->GetDevName() : NAME_None);
+		}
+	}
+
+	for (UGameSetting* ChildSetting : InSetting->GetChildSettings())
+	{
+		AddSubtree(ChildSetting, EntryIndex);
+	}
+}
+
+void FGameSettingRegistrySnapshot::Reset()
+{
+	DefinitionVersion = 0;
+	Entries.Reset();
+	EntryIndices.Reset();
+}
+
+void FGameSettingRegistrySnapshot::RebuildEntryIndices()
+{
+	EntryIndices.Reset();
+	EntryIndices.Reserve(Entries.Num());
+
+	// The first setting with a DevName wins, matching the registry's lookups.
+	for (int32 EntryIndex = 0; EntryIndex < Entries.Num(); ++EntryIndex)
+	{
+		if (!EntryIndices.Contains(Entries[EntryIndex].DevName))
+		{
+			EntryIndices.Add(Entries[EntryIndex].DevName, EntryIndex);
+		}
+	}
+}
+
+FName FGameSettingRegistrySnapshot::FindTopLevelDevName(const FName& InDevName) const
+{
+	int32 EntryIndex = FindEntryIndex(InDevName);
+	if (EntryIndex == INDEX_NONE)
+	{
+		return NAME_None;
+	}
+
+	// Parents always come before their children, so this always ends.
+	while (Entries[EntryIndex].ParentIndex != INDEX_NONE)
+	{
+		EntryIndex = Entries[EntryIndex].ParentIndex;
+	}
+
+	return Entries[EntryIndex].DevName;
+}
+
+FName FGameSettingRegistrySnapshot::GetParentDevName(const FEntry& InEntry) const
+{
+	return Entries.IsValidIndex(InEntry.ParentIndex) ? Entries[InEntry.ParentIndex].DevName : NAME_None;
+}
+
+bool FGameSettingRegistrySnapshot::Serialize(FArchive& Ar)
+{
+	uint32 Magic = GameSettingRegistrySnapshot::Magic;
+	uint32 FormatVersion = GameSettingRegistrySnapshot::FormatVersion;
+	Ar << Magic;
+	Ar << FormatVersion;
+
+	if (Ar.IsLoading() && (Magic != GameSettingRegistrySnapshot::Magic || FormatVersion != GameSettingRegistrySnapshot::FormatVersion))
+	{
+		Reset();
+		return false;
+	}
+
+	Ar << DefinitionVersion;
+	Ar << Entries;
+
+	if (Ar.IsLoading())
+	{
+		// Parents must come before their children, anything else isn't a snapshot we wrote.
+		for (int32 EntryIndex = 0; EntryIndex < Entries.Num(); ++EntryIndex)
+		{
+			if (Entries[EntryIndex].ParentIndex < INDEX_NONE || Entries[EntryIndex].ParentIndex >= EntryIndex)
+			{
+				Ar.SetError();
+				break;
+			}
+		}
+
+		if (Ar.IsError())
+		{
+			Reset();
+			return false;
+		}
+
+		RebuildEntryIndices();
+	}
+
+	return !Ar.IsError();
+}
+
+bool FGameSettingRegistrySnapshot::SaveToFile(const FString& InFilename)
+{
+	TArray<uint8> Bytes;
+	FMemoryWriter Writer(Bytes);
+	if (!Serialize(Writer))
+	{
+		return false;
+	}
+
+	return FFileHelper::SaveArrayToFile(Bytes, *InFilename);
+}
+
+bool FGameSettingRegistrySnapshot::LoadFromFile(const FString& InFilename, uint32 InExpectedDefinitionVersion)
+{
+	Reset();
+
+	TArray<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *InFilename, FILEREAD_Silent))
+	{
+		return false;
+	}
+
+	FMemoryReader Reader(Bytes);
+	if (!Serialize(Reader) || DefinitionVersion != InExpectedDefinitionVersion)
+	{
+		Reset();
+		return false;
+	}
+
+	return true;
+}
+
+void FGameSettingRegistrySnapshot::Diff(const FGameSettingRegistrySnapshot& Other, TArray<FString>& OutDifferences) const
+{
+	if (DefinitionVersion != Other.DefinitionVersion)
+	{
+		OutDifferences.Add(FString::Printf(TEXT("Definition version %u, expected %u"), Other.DefinitionVersion, DefinitionVersion));
+	}
+
+	for (const FEntry& Entry : Entries)
+	{
+		const int32 OtherIndex = Other.FindEntryIndex(Entry.DevName);
+		if (OtherIndex == INDEX_NONE)
+		{
+			OutDifferences.Add(FString::Printf(TEXT("%s: missing"), *Entry.DevName.ToString()));
+			continue;
+		}
+
+		const FEntry& OtherEntry = Other.Entries[OtherIndex];
+		const FString DevName = Entry.DevName.ToString();
+
+		if (Entry.ClassPath != OtherEntry.ClassPath)
+		{
+			OutDifferences.Add(FString::Printf(TEXT("%s: class %s, expected %s"), *DevName, *OtherEntry.ClassPath, *Entry.ClassPath));
+		}
+
+		const FName ParentDevName = GetParentDevName(Entry);
+		const FName OtherParentDevName = Other.GetParentDevName(OtherEntry);
+		if (ParentDevName != OtherParentDevName)
+		{
+			OutDifferences.Add(FString::Printf(TEXT("%s: parent %s, expected %s"), *DevName, *OtherParentDevName.ToString(), *ParentDevName.ToString()));
+		}
+
+		if (Entry.OptionValues != OtherEntry.OptionValues)
+		{
+			OutDifferences.Add(FString::Printf(TEXT("%s: options [%s], expected [%s]"), *DevName, *FString::Join(OtherEntry.OptionValues, TEXT(", ")), *FString::Join(Entry.OptionValues, TEXT(", "))));
+		}
+
+		if (Entry.EditConditions != OtherEntry.EditConditions)
+		{
+			OutDifferences.Add(FString::Printf(TEXT("%s: edit conditions [%s], expected [%s]"), *DevName, *FString::Join(OtherEntry.EditConditions, TEXT(", ")), *FString::Join(Entry.EditConditions, TEXT(", "))));
+		}
+
+		if (Entry.EditDependencies != OtherEntry.EditDependencies)
+		{
+			auto JoinNames = [](const TArray<FName>& Names) { return FString::JoinBy(Names, TEXT(", "), [](const FName& Name) { return Name.ToString(); }); };
+			OutDifferences.Add(FString::Printf(TEXT("%s: edit dependencies [%s], expected [%s]"), *DevName, *JoinNames(OtherEntry.EditDependencies), *JoinNames(Entry.EditDependencies)));
+		}
+	}
+
+	for (const FEntry& OtherEntry : Other.Entries)
+	{
+		if (FindEntryIndex(OtherEntry.DevName) == INDEX_NONE)
+		{
+			OutDifferences.Add(FString::Printf(TEXT("%s: not in the snapshot"), *OtherEntry.DevName.ToString()));
+		}
+	}
+
+	// The order of the settings matters to the screens, even when every setting is the same.
+	if (OutDifferences.Num() == 0 && Entries.Num() == Other.Entries.Num())
+	{
+		for (int32 EntryIndex = 0; EntryIndex < Entries.Num(); ++EntryIndex)
+		{
+			if (Entries[EntryIndex].DevName != Other.Entries[EntryIndex].DevName)
+			{
+				OutDifferences.Add(FString::Printf(TEXT("%s: moved to index %d"), *Other.Entries[EntryIndex].DevName.ToString(), EntryIndex));
+				break;
+			}
+		}
+	}
+}
@@ -0,0 +1,208 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "GameSettingSearchIndex.h"
+
+#include "Algo/Unique.h"
+#include "GameSetting.h"
+#include "Internationalization/Internationalization.h"
+
+namespace GameSettingSearchIndex
+{
+	/** Packs three characters into a key, 21 bits covers every unicode code point. */
+	static uint64 MakeTrigram(TCHAR A, TCHAR B, TCHAR C)
+	{
+		constexpr uint64 CharMask = 0x1FFFFF;
+		return (((uint64)A & CharMask) << 42) | (((uint64)B & CharMask) << 21) | ((uint64)C & CharMask);
+	}
+
+	/** Is this a plain search term, rather than one the text filter gives special meaning, like quotes or operators. */
+	static bool IsPlainTerm(const FString& InTerm)
+	{
+		if (InTerm.Equals(TEXT("AND"), ESearchCase::IgnoreCase) || InTerm.Equals(TEXT("OR"), ESearchCase::IgnoreCase) || InTerm.Equals(TEXT("NOT"), ESearchCase::IgnoreCase))
+		{
+			return false;
+		}
+
+		for (const TCHAR Char : InTerm)
+		{
+			if (!FChar::IsAlnum(Char))
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+}
+
+//--------------------------------------
+// FGameSettingSearchIndex
+//--------------------------------------
+
+void FGameSettingSearchIndex::Reset()
+{
+	Entries.Reset();
+	EntriesByTrigram.Reset();
+	IndexedCulture.Reset();
+	IndexedSearchableTextEpoch = 0;
+	bDirty = true;
+}
+
+bool FGameSettingSearchIndex::GatherCandidates(TConstArrayView<TObjectPtr<UGameSetting>> InSettings, const FString& InSearchText, TSet<const UGameSetting*>& OutCandidates)
+{
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_FGameSettingSearchIndex_GatherCandidates);
+
+	TArray<FString> Terms;
+	InSearchText.ParseIntoArrayWS(Terms);
+
+	TArray<TArray<uint64>> TermTrigrams;
+	for (const FString& Term : Terms)
+	{
+		if (!GameSettingSearchIndex::IsPlainTerm(Term))
+		{
+			return false;
+		}
+
+		// Terms too short to have a trigram don't narrow anything down, the text filter still tests them.
+		TArray<uint64> Trigrams;
+		if (GatherTrigrams(Term.ToUpper(), Trigrams))
+		{
+			TermTrigrams.Add(MoveTemp(Trigrams));
+		}
+	}
+
+	if (TermTrigrams.Num() == 0)
+	{
+		return false;
+	}
+
+	const FCultureRef CurrentCulture = FInternationalization::Get().GetCurrentCulture();
+	if (bDirty || IndexedCulture != CurrentCulture)
+	{
+		Rebuild(InSettings);
+		IndexedCulture = CurrentCulture;
+	}
+	else if (IndexedSearchableTextEpoch != UGameSetting::GetSearchableTextEpoch())
+	{
+		UpdateStaleEntries();
+	}
+
+	TBitArray<> Matches(true, Entries.Num());
+	TBitArray<> TrigramMatches;
+	for (const TArray<uint64>& Trigrams : TermTrigrams)
+	{
+		for (const uint64 Trigram : Trigrams)
+		{
+			const TArray<int32>* TrigramEntries = EntriesByTrigram.Find(Trigram);
+			if (!TrigramEntries)
+			{
+				// Nothing contains this part of the term, so nothing can match.
+				return true;
+			}
+
+			TrigramMatches.Init(false, Entries.Num());
+			for (const int32 EntryIndex : *TrigramEntries)
+			{
+				TrigramMatches[EntryIndex] = true;
+			}
+
+			Matches.CombineWithBitwiseAND(TrigramMatches, EBitwiseOperatorFlags::MaintainSize);
+		}
+	}
+
+	for (TConstSetBitIterator<> It(Matches); It; ++It)
+	{
+		OutCandidates.Add(Entries[It.GetIndex()].Setting);
+	}
+
+	return true;
+}
+
+void FGameSettingSearchIndex::Rebuild(TConstArrayView<TObjectPtr<UGameSetting>> InSettings)
+{
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_FGameSettingSearchIndex_Rebuild);
+
+	Entries.Reset(InSettings.Num());
+	EntriesByTrigram.Reset();
+
+	for (const UGameSetting* Setting : InSettings)
+	{
+		if (!Setting)
+		{
+			continue;
+		}
+
+		FEntry& Entry = Entries.AddDefaulted_GetRef();
+		Entry.Setting = Setting;
+		IndexEntry(Entries.Num() - 1);
+	}
+
+	IndexedSearchableTextEpoch = UGameSetting::GetSearchableTextEpoch();
+	bDirty = false;
+}
+
+void FGameSettingSearchIndex::UpdateStaleEntries()
+{
+	for (int32 EntryIndex = 0; EntryIndex < Entries.Num(); ++EntryIndex)
+	{
+		if (Entries[EntryIndex].SearchableTextVersion != Entries[EntryIndex].Setting->GetSearchableTextVersion())
+		{
+			UnindexEntry(EntryIndex);
+			IndexEntry(EntryIndex);
+		}
+	}
+
+	IndexedSearchableTextEpoch = UGameSetting::GetSearchableTextEpoch();
+}
+
+void FGameSettingSearchIndex::IndexEntry(int32 EntryIndex)
+{
+	FEntry& Entry = Entries[EntryIndex];
+	Entry.SearchableTextVersion = Entry.Setting->GetSearchableTextVersion();
+	Entry.Trigrams.Reset();
+
+	// Match the text filter, which searches the plain text of the description ignoring case.
+	if (GatherTrigrams(Entry.Setting->GetDescriptionPlainText().ToUpper(), Entry.Trigrams))
+	{
+		Entry.Trigrams.Sort();
+		Entry.Trigrams.SetNum(Algo::Unique(Entry.Trigrams));
+
+		for (const uint64 Trigram : Entry.Trigrams)
+		{
+			EntriesByTrigram.FindOrAdd(Trigram).Add(EntryIndex);
+		}
+	}
+}
+
+void FGameSettingSearchIndex::UnindexEntry(int32 EntryIndex)
+{
+	for (const uint64 Trigram : Entries[EntryIndex].Trigrams)
+	{
+		if (TArray<int32>* TrigramEntries = EntriesByTrigram.Find(Trigram))
+		{
+			TrigramEntries->RemoveSingleSwap(EntryIndex);
+			if (TrigramEntries->Num() == 0)
+			{
+				EntriesByTrigram.Remove(Trigram);
+			}
+		}
+	}
+
+	Entries[EntryIndex].Trigrams.Reset();
+}
+
+bool FGameSettingSearchIndex::GatherTrigrams(const FString& InText, TArray<uint64>& OutTrigrams)
+{
+	if (InText.Len() < 3)
+	{
+		return false;
+	}
+
+	OutTrigrams.Reserve(OutTrigrams.Num() + InText.Len() - 2);
+	for (int32 CharIndex = 0; CharIndex + 2 < InText.Len(); ++CharIndex)
+	{
+		OutTrigrams.Add(GameSettingSearchIndex::MakeTrigram(InText[CharIndex], InText[CharIndex + 1], InText[CharIndex + 2]));
+	}
+
+	return true;
+}
@@ -0,0 +1,196 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "GameSettingStartupScheduler.h"
+
+#include "GameSetting.h"
+#include "GameSettingFilterState.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+
+namespace GameSettingStartupScheduler
+{
+	static TMap<FName, FGameSettingStartupScheduler::FProviderStats> ProviderStats;
+}
+
+//--------------------------------------
+// FGameSettingStartupScheduler
+//--------------------------------------
+
+FGameSettingStartupScheduler* FGameSettingStartupScheduler::ActiveScheduler = nullptr;
+
+void FGameSettingStartupScheduler::BeginBatch(ULocalPlayer* InLocalPlayer)
+{
+	check(IsInGameThread());
+
+	if (BatchDepth++ == 0)
+	{
+		ensureMsgf(ActiveScheduler == nullptr || ActiveScheduler == this, TEXT("Only one startup scheduler can have a batch open at a time."));
+		ActiveScheduler = this;
+		LocalPlayer = InLocalPlayer;
+	}
+}
+
+void FGameSettingStartupScheduler::EndBatch()
+{
+	if (!ensure(BatchDepth > 0) || --BatchDepth > 0)
+	{
+		return;
+	}
+
+	if (ActiveScheduler == this)
+	{
+		ActiveScheduler = nullptr;
+	}
+
+	// Providers can complete as soon as they're asked to, which changes PendingProviders.
+	TArray<FName> ProvidersToFetch;
+	for (const TPair<FName, FPendingProvider>& Pending : PendingProviders)
+	{
+		if (!Pending.Value.bFetching)
+		{
+			ProvidersToFetch.Add(Pending.Key);
+		}
+	}
+
+	for (const FName ProviderName : ProvidersToFetch)
+	{
+		FPendingProvider* Pending = PendingProviders.Find(ProviderName);
+		if (!Pending || Pending->bFetching)
+		{
+			continue;
+		}
+
+		Pending->bFetching = true;
+		Pending->FetchStartTime = FPlatformTime::Seconds();
+
+		const TSharedPtr<FGameSettingStartupProvider> Provider = Pending->Provider;
+		Provider->Fetch(LocalPlayer.Get(), FSimpleDelegate::CreateSP(this, &FGameSettingStartupScheduler::HandleProviderFetched, ProviderName));
+	}
+}
+
+void FGameSettingStartupScheduler::Reset()
+{
+	NumProvidersPendingBySetting.Reset();
+
+	for (auto It = PendingProviders.CreateIterator(); It; ++It)
+	{
+		if (It.Value().bFetching)
+		{
+			It.Value().Settings.Reset();
+		}
+		else
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void FGameSettingStartupScheduler::StartupWhenProvidersReady(UGameSetting* InSetting)
+{
+	if (ActiveScheduler)
+	{
+		ActiveScheduler->QueueSetting(InSetting);
+		return;
+	}
+
+	static TSharedRef<FGameSettingStartupScheduler> UnbatchedScheduler = MakeShared<FGameSettingStartupScheduler>();
+
+	FGameSettingStartupBatchScope Batch(*UnbatchedScheduler, InSetting->GetOwningLocalPlayer());
+	UnbatchedScheduler->QueueSetting(InSetting);
+}
+
+void FGameSettingStartupScheduler::QueueSetting(UGameSetting* InSetting)
+{
+	const TConstArrayView<TSharedRef<FGameSettingStartupProvider>> Providers = InSetting->GetStartupProviders();
+	if (Providers.Num() == 0)
+	{
+		InSetting->Startup();
+		return;
+	}
+
+	for (const TSharedRef<FGameSettingStartupProvider>& Provider : Providers)
+	{
+		FPendingProvider& Pending = PendingProviders.FindOrAdd(Provider->GetProviderName());
+		if (!Pending.Provider)
+		{
+			Pending.Provider = Provider;
+		}
+
+		Pending.Settings.Add(InSetting);
+	}
+
+	NumProvidersPendingBySetting.Add(InSetting, Providers.Num());
+}
+
+void FGameSettingStartupScheduler::HandleProviderFetched(FName InProviderName)
+{
+	FPendingProvider Fetched;
+	if (!PendingProviders.RemoveAndCopyValue(InProviderName, Fetched))
+	{
+		return;
+	}
+
+	const double SecondsToReady = FPlatformTime::Seconds() - Fetched.FetchStartTime;
+
+	FProviderStats& Stats = GameSettingStartupScheduler::ProviderStats.FindOrAdd(InProviderName);
+	Stats.NumFetches++;
+	Stats.TotalSecondsToReady += SecondsToReady;
+	Stats.MaxSecondsToReady = FMath::Max(Stats.MaxSecondsToReady, SecondsToReady);
+
+	TArray<UGameSetting*> ReadySettings;
+	for (const TWeakObjectPtr<UGameSetting>& WeakSetting : Fetched.Settings)
+	{
+		int32* NumProvidersPending = NumProvidersPendingBySetting.Find(WeakSetting);
+		if (NumProvidersPending && --(*NumProvidersPending) == 0)
+		{
+			NumProvidersPendingBySetting.Remove(WeakSetting);
+			if (UGameSetting* Setting = WeakSetting.Get())
+			{
+				ReadySettings.Add(Setting);
+			}
+		}
+	}
+
+	if (ReadySettings.Num() > 0)
+	{
+		Stats.NumSettingsStarted += ReadySettings.Num();
+
+		// Everything this provider was holding back starts up together, and nothing changes while they do.
+		FGameSettingEditConditionCacheScope EditConditionCache;
+		for (UGameSetting* Setting : ReadySettings)
+		{
+			Setting->Startup();
+		}
+	}
+}
+
+const TMap<FName, FGameSettingStartupScheduler::FProviderStats>& FGameSettingStartupScheduler::GetProviderStats()
+{
+	return GameSettingStartupScheduler::ProviderStats;
+}
+
+void FGameSettingStartupScheduler::ResetProviderStats()
+{
+	GameSettingStartupScheduler::ProviderStats.Reset();
+}
+
+#if !UE_BUILD_SHIPPING
+static FAutoConsoleCommand CmdDumpStartupProviders(
+	TEXT("GameSettings.DumpStartupProviders"),
+	TEXT("Logs how long each settings startup provider took to fetch.  Pass 'reset' to clear them afterwards."),
+	FConsoleCommandWithArgsDelegate::CreateStatic([](const TArray<FString>& Args)
+	{
+		for (const TPair<FName, FGameSettingStartupScheduler::FProviderStats>& Pair : FGameSettingStartupScheduler::GetProviderStats())
+		{
+			const FGameSettingStartupScheduler::FProviderStats& Stats = Pair.Value;
+			UE_LOG(LogConsoleResponse, Display, TEXT("%s: %d fetches, %d settings started, %.3fms total, %.3fms average, %.3fms max"),
+				*Pair.Key.ToString(), Stats.NumFetches, Stats.NumSettingsStarted,
+				Stats.TotalSecondsToReady * 1000.0, Stats.TotalSecondsToReady * 1000.0 / FMath::Max(Stats.NumFetches, 1), Stats.MaxSecondsToReady * 1000.0);
+		}
+
+		if (Args.Num() > 0 && Args[0] == TEXT("reset"))
+		{
+			FGameSettingStartupScheduler::ResetProviderStats();
+		}
+	}));
+#endif
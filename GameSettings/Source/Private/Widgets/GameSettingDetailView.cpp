@@ -94,17 +94,17 @@ void UGameSettingDetailView::FillSettingDetails(UGameSetting* InSetting)
 
 		if (InSetting)
 		{
-			FGameSettingEditableState EditableState = InSetting->GetEditState();
+			const FGameSettingEditableState& EditableState = InSetting->GetEditState();
 
 			if (!EditableState.IsEnabled())
 			{
-				for (FText Reason : EditableState.GetDisabledReasons())
+				for (const FText& Reason : EditableState.GetDisabledReasons())
 				{
 					DisabledDetailLines.Add(FText::Format(LOCTEXT("DisabledReasonLine", "<Icon.Warning></> {0}"), Reason));
 				}
 			}
 
-			if (EditableState.GetDisabledOptions().Num() > 0)
+			if (EditableState.HasDisabledOptions())
 			{
 				DisabledDetailLines.Add(LOCTEXT("DisabledOptionReasonLine", "<Icon.Warning></> There are fewer options than available due to Parental Controls."));
 			}
@@ -70,8 +70,7 @@ void UGameSettingListEntryBase::OnSettingChanged()
 
 void UGameSettingListEntryBase::HandleEditConditionChanged(UGameSetting* InSetting)
 {
-	const FGameSettingEditableState EditableState = Setting->GetEditState();
-	RefreshEditableState(EditableState);
+	RefreshEditableState(Setting->GetEditState());
 }
 
 void UGameSettingListEntryBase::RefreshEditableState(const FGameSettingEditableState& InEditableState)
@@ -116,6 +115,7 @@ void UGameSettingListEntry_Setting::SetSetting(UGameSetting* InSetting)
 void UGameSettingListEntrySetting_Discrete::SetSetting(UGameSetting* InSetting)
 {
 	DiscreteSetting = Cast<UGameSettingValueDiscrete>(InSetting);
+	PopulatedOptionsVersion.Reset();
 
 	Super::SetSetting(InSetting);
 	
@@ -126,10 +126,17 @@ void UGameSettingListEntrySetting_Discrete::Refresh()
 {
 	if (ensure(DiscreteSetting))
 	{
-		const TArray<FText> Options = DiscreteSetting->GetDiscreteOptions();
-		ensure(Options.Num() > 0);
+		// Settings that don't version their options could have changed them at any time.
+		const uint32 OptionsVersion = DiscreteSetting->GetDiscreteOptionsVersion();
+		if (!DiscreteSetting->AreDiscreteOptionsVersioned() || PopulatedOptionsVersion != OptionsVersion)
+		{
+			const TConstArrayView<FText> Options = DiscreteSetting->GetDiscreteOptionsView();
+			ensure(Options.Num() > 0);
+
+			Rotator_SettingValue->PopulateTextLabels(TArray<FText>(Options));
+			PopulatedOptionsVersion = OptionsVersion;
+		}
 
-		Rotator_SettingValue->PopulateTextLabels(Options);
 		Rotator_SettingValue->SetSelectedItem(DiscreteSetting->GetDiscreteOptionIndex());
 		Rotator_SettingValue->SetDefaultOption(DiscreteSetting->GetDiscreteOptionDefaultIndex());
 	}
@@ -160,6 +167,7 @@ void UGameSettingListEntrySetting_Discrete::NativeOnEntryReleased()
 	Super::NativeOnEntryReleased();
 
 	DiscreteSetting = nullptr;
+	PopulatedOptionsVersion.Reset();
 }
 
 void UGameSettingListEntrySetting_Discrete::HandleOptionDecrease()
@@ -68,8 +68,11 @@ void UGameSettingPanel::SetRegistry(UGameSettingRegistry* InRegistry)
 		if (RefreshHandle.IsValid())
 		{
 			FTSTicker::GetCoreTicker().RemoveTicker(RefreshHandle);
+			RefreshHandle.Reset();
 		}
 
+		bRefreshWhenRegistryReady = false;
+
 		Registry = InRegistry;
 
 		RegisterRegistryEvents();
@@ -85,6 +88,13 @@ void UGameSettingPanel::RegisterRegistryEvents()
 		Registry->OnSettingEditConditionChangedEvent.AddUObject(this, &ThisClass::HandleSettingEditConditionsChanged);
 		Registry->OnSettingNamedActionEvent.AddUObject(this, &ThisClass::HandleSettingNamedAction);
 		Registry->OnExecuteNavigationEvent.AddUObject(this, &ThisClass::HandleSettingNavigation);
+		Registry->OnFinishedInitializingEvent.AddUObject(this, &ThisClass::HandleRegistryFinishedInitializing);
+
+		// We may have missed the registry finishing while we weren't listening.
+		if (bRefreshWhenRegistryReady && Registry->IsFinishedInitializing())
+		{
+			HandleRegistryFinishedInitializing();
+		}
 	}
 }
 
@@ -95,6 +105,7 @@ void UGameSettingPanel::UnregisterRegistryEvents()
 		Registry->OnSettingEditConditionChangedEvent.RemoveAll(this);
 		Registry->OnSettingNamedActionEvent.RemoveAll(this);
 		Registry->OnExecuteNavigationEvent.RemoveAll(this);
+		Registry->OnFinishedInitializingEvent.RemoveAll(this);
 	}
 }
 
@@ -157,11 +168,18 @@ TArray<UGameSetting*> UGameSettingPanel::GetSettingsWeCanResetToDefault() const
 
 void UGameSettingPanel::RefreshSettingsList()
 {
-	if (RefreshHandle.IsValid())
+	if (RefreshHandle.IsValid() || bRefreshWhenRegistryReady)
 	{
 		return;
 	}
 
+	// Rather than polling the registry every frame, wait for it to tell us it's done initializing.
+	if (!Registry->IsFinishedInitializing())
+	{
+		bRefreshWhenRegistryReady = true;
+		return;
+	}
+
 	RefreshHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateWeakLambda(this, [this](float DeltaTime)
 	{
 		QUICK_SCOPE_CYCLE_COUNTER(STAT_UGameSettingPanel_RefreshSettingsList);
@@ -201,22 +219,37 @@ void UGameSettingPanel::RefreshSettingsList()
 
 			bAdjustListViewPostRefresh = true;
 
-			// finally, refresh the editable state, but only once.
+			// finally, refresh the editable state, but only once, and only for settings whose inputs changed or that
+			// have volatile edit conditions.
+			FGameSettingEditConditionCacheScope EditConditionCache;
 			for (int32 SettingIdx = 0; SettingIdx < VisibleSettings.Num(); ++SettingIdx)
 			{
 				if (UGameSetting* Setting = VisibleSettings[SettingIdx])
 				{
-					Setting->RefreshEditableState(false);
+					Setting->RefreshEditableStateIfStale(false);
 				}
-			}			
-
-			return false;
+			}
+		}
+		else
+		{
+			// The registry went back to initializing since we queued the refresh, e.g. a lazy setting was built.
+			RefreshHandle.Reset();
+			bRefreshWhenRegistryReady = true;
 		}
 
-		return true;
+		return false;
 	}));
 }
 
+void UGameSettingPanel::HandleRegistryFinishedInitializing()
+{
+	if (bRefreshWhenRegistryReady)
+	{
+		bRefreshWhenRegistryReady = false;
+		RefreshSettingsList();
+	}
+}
+
 void UGameSettingPanel::HandleSettingItemHoveredChanged(UObject* Item, bool bHovered)
 {
 	UGameSetting* Setting = bHovered ? Cast<UGameSetting>(Item) : ToRawPtr(LastHoveredOrSelectedSetting);
@@ -59,9 +59,9 @@ void UGameSettingScreen::ApplyChanges()
 {
 	if (ChangeTracker.HaveSettingsBeenChanged())
 	{
-		ChangeTracker.ApplyChanges();
+		const FGameSettingApplyCategories DirtyCategories = ChangeTracker.ApplyChanges();
 		ClearDirtyState();
-		Registry->SaveChanges();
+		Registry->SaveChanges(DirtyCategories);
 	}
 }
 
@@ -3,6 +3,8 @@
 #pragma once
 
 #include "Delegates/Delegate.h"
+#include "Math/Color.h"
+#include "Math/Vector2D.h"
 
 class ULocalPlayer;
 
@@ -27,5 +29,22 @@ public:
 
 	virtual void SetValue(ULocalPlayer* InContext, const FString& Value) = 0;
 
+	/**
+	 * Typed access to the value, so settings don't have to round trip it through a string.  Returns false if the
+	 * data source can't provide the value as that type, in which case the string functions have to be used.  Enums
+	 * are passed as their underlying value.
+	 */
+	virtual bool TryGetValue(ULocalPlayer* InContext, bool& OutValue) const { return false; }
+	virtual bool TryGetValue(ULocalPlayer* InContext, int64& OutValue) const { return false; }
+	virtual bool TryGetValue(ULocalPlayer* InContext, double& OutValue) const { return false; }
+	virtual bool TryGetValue(ULocalPlayer* InContext, FLinearColor& OutValue) const { return false; }
+	virtual bool TryGetValue(ULocalPlayer* InContext, FVector2D& OutValue) const { return false; }
+
+	virtual bool TrySetValue(ULocalPlayer* InContext, bool InValue) { return false; }
+	virtual bool TrySetValue(ULocalPlayer* InContext, int64 InValue) { return false; }
+	virtual bool TrySetValue(ULocalPlayer* InContext, double InValue) { return false; }
+	virtual bool TrySetValue(ULocalPlayer* InContext, const FLinearColor& InValue) { return false; }
+	virtual bool TrySetValue(ULocalPlayer* InContext, const FVector2D& InValue) { return false; }
+
 	virtual FString ToString() const = 0;
 };
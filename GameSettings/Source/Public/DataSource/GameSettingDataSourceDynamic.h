@@ -4,10 +4,13 @@
 
 #include "GameSettingDataSource.h"
 #include "PropertyPathHelpers.h"
+#include "UObject/WeakObjectPtrTemplates.h"
 
 #define UE_API GAMESETTINGS_API
 
+class FProperty;
 class ULocalPlayer;
+class UFunction;
 
 //--------------------------------------
 // FGameSettingDataSourceDynamic
@@ -24,10 +27,62 @@ public:
 
 	UE_API virtual void SetValue(ULocalPlayer* InLocalPlayer, const FString& Value) override;
 
+	UE_API virtual bool TryGetValue(ULocalPlayer* InLocalPlayer, bool& OutValue) const override;
+	UE_API virtual bool TryGetValue(ULocalPlayer* InLocalPlayer, int64& OutValue) const override;
+	UE_API virtual bool TryGetValue(ULocalPlayer* InLocalPlayer, double& OutValue) const override;
+	UE_API virtual bool TryGetValue(ULocalPlayer* InLocalPlayer, FLinearColor& OutValue) const override;
+	UE_API virtual bool TryGetValue(ULocalPlayer* InLocalPlayer, FVector2D& OutValue) const override;
+
+	UE_API virtual bool TrySetValue(ULocalPlayer* InLocalPlayer, bool InValue) override;
+	UE_API virtual bool TrySetValue(ULocalPlayer* InLocalPlayer, int64 InValue) override;
+	UE_API virtual bool TrySetValue(ULocalPlayer* InLocalPlayer, double InValue) override;
+	UE_API virtual bool TrySetValue(ULocalPlayer* InLocalPlayer, const FLinearColor& InValue) override;
+	UE_API virtual bool TrySetValue(ULocalPlayer* InLocalPlayer, const FVector2D& InValue) override;
+
 	UE_API virtual FString ToString() const override;
 
+#if !UE_BUILD_SHIPPING
+	/** Times reading every resolved dynamic data source through its compiled accessors and through the property path, see GameSettings.BenchmarkDataSources. */
+	static UE_API void BenchmarkAccessors(int32 Iterations);
+
+	UE_API virtual ~FGameSettingDataSourceDynamic();
+#endif
+
 private:
+	/**
+	 * The path compiled down to the functions and properties it goes through, so reading and writing doesn't need
+	 * to walk the property path.  Every object along the way is still fetched each time, since e.g. the shared
+	 * settings object can be replaced, but the path is only compiled again if the root object changes.
+	 */
+	struct FCompiledSegment
+	{
+		/** Either a getter function, a setter function for the last segment, or a property. */
+		UFunction* Function = nullptr;
+		FProperty* Property = nullptr;
+	};
+
+	/** Compiles the path for the root object, returns false if it goes through anything the compiled accessors don't support. */
+	UE_API bool CompileAccessors(UObject* InRoot) const;
+	UE_API bool AreAccessorsCompiledFor(UObject* InRoot) const;
+
+	/** Follows every segment but the last, returning the object the last segment is read from or written to. */
+	UE_API UObject* GetLeafContainer(UObject* InRoot) const;
+
+	UE_API bool GetCompiledValueAsString(UObject* InRoot, FString& OutStringValue) const;
+	UE_API bool SetCompiledValue(UObject* InRoot, const FString& InStringValue) const;
+
+	/** Reads or writes the value as the type, if the compiled accessors end in a property of a compatible type. */
+	template<typename ValueType>
+	bool GetCompiledTypedValue(UObject* InRoot, ValueType& OutValue) const;
+	template<typename ValueType>
+	bool SetCompiledTypedValue(UObject* InRoot, const ValueType& InValue) const;
+
 	FCachedPropertyPath DynamicPath;
+	TArray<FName> SegmentNames;
+
+	mutable TArray<FCompiledSegment> CompiledSegments;
+	mutable TWeakObjectPtr<UObject> CompiledRoot;
+	mutable bool bCompiledAccessorsSupported = true;
 };
 
 #undef UE_API
@@ -0,0 +1,202 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "DataSource/GameSettingDataSource.h"
+#include "Templates/Function.h"
+#include "Templates/Identity.h"
+#include "UObject/Class.h"
+
+class ULocalPlayer;
+
+//--------------------------------------
+// GameSettingDataSourceNative
+//--------------------------------------
+
+namespace GameSettingDataSourceNative
+{
+	/** Converts a value to the string form the discrete settings use for their options. */
+	template<typename ValueType>
+	FString ValueToString(const ValueType& InValue)
+	{
+		if constexpr (TIsEnum<ValueType>::Value)
+		{
+			return StaticEnum<ValueType>()->GetNameStringByValue((int64)InValue);
+		}
+		else if constexpr (std::is_same_v<ValueType, FLinearColor> || std::is_same_v<ValueType, FVector2D>)
+		{
+			return InValue.ToString();
+		}
+		else
+		{
+			return LexToString(InValue);
+		}
+	}
+
+	template<typename ValueType>
+	bool ValueFromString(const FString& InString, ValueType& OutValue)
+	{
+		if constexpr (TIsEnum<ValueType>::Value)
+		{
+			const int64 EnumValue = StaticEnum<ValueType>()->GetValueByNameString(InString);
+			OutValue = (ValueType)EnumValue;
+			return EnumValue != INDEX_NONE;
+		}
+		else if constexpr (std::is_same_v<ValueType, FLinearColor> || std::is_same_v<ValueType, FVector2D>)
+		{
+			return OutValue.InitFromString(InString);
+		}
+		else
+		{
+			LexFromString(OutValue, *InString);
+			return true;
+		}
+	}
+
+	/** The type a value travels through the typed channel as, see FGameSettingDataSource::TryGetValue. */
+	template<typename ValueType>
+	using TTypedChannel =
+		std::conditional_t<std::is_same_v<ValueType, bool>, bool,
+		std::conditional_t<std::is_floating_point_v<ValueType>, double,
+		std::conditional_t<std::is_integral_v<ValueType> || TIsEnum<ValueType>::Value, int64,
+		ValueType>>>;
+}
+
+//--------------------------------------
+// TGameSettingDataSourceNative
+//--------------------------------------
+
+/**
+ * A data source built from native getter and setter callables, rather than a path that has to be resolved with
+ * reflection.  Registrations made in C++ should prefer this, it skips path parsing and resolution entirely, and
+ * a getter or setter that doesn't exist fails to compile instead of failing to resolve at runtime.
+ *
+ * Either callable may be unbound, since settings take separate getter and setter data sources.
+ */
+template<typename OwnerType, typename ValueType>
+class TGameSettingDataSourceNative : public FGameSettingDataSource
+{
+public:
+	using FOwnerAccessor = TFunction<OwnerType*(ULocalPlayer*)>;
+	using FGetter = TFunction<ValueType(const OwnerType&)>;
+	using FSetter = TFunction<void(OwnerType&, const ValueType&)>;
+
+	TGameSettingDataSourceNative(FOwnerAccessor&& InOwnerAccessor, FGetter&& InGetter, FSetter&& InSetter, FString InName)
+		: OwnerAccessor(MoveTemp(InOwnerAccessor))
+		, Getter(MoveTemp(InGetter))
+		, Setter(MoveTemp(InSetter))
+		, Name(MoveTemp(InName))
+	{
+	}
+
+	virtual bool Resolve(ULocalPlayer* InContext) override
+	{
+		return OwnerAccessor(InContext) != nullptr;
+	}
+
+	virtual FString GetValueAsString(ULocalPlayer* InContext) const override
+	{
+		const OwnerType* Owner = OwnerAccessor(InContext);
+		if (!ensureMsgf(Owner && Getter, TEXT("%s can't be read"), *Name))
+		{
+			return FString();
+		}
+
+		return GameSettingDataSourceNative::ValueToString(Getter(*Owner));
+	}
+
+	virtual void SetValue(ULocalPlayer* InContext, const FString& InStringValue) override
+	{
+		OwnerType* Owner = OwnerAccessor(InContext);
+		if (!ensureMsgf(Owner && Setter, TEXT("%s can't be written"), *Name))
+		{
+			return;
+		}
+
+		ValueType Value{};
+		if (ensureMsgf(GameSettingDataSourceNative::ValueFromString(InStringValue, Value), TEXT("%s: '%s' is not a valid value"), *Name, *InStringValue))
+		{
+			Setter(*Owner, Value);
+		}
+	}
+
+	virtual bool TryGetValue(ULocalPlayer* InContext, bool& OutValue) const override { return GetTypedValue(InContext, OutValue); }
+	virtual bool TryGetValue(ULocalPlayer* InContext, int64& OutValue) const override { return GetTypedValue(InContext, OutValue); }
+	virtual bool TryGetValue(ULocalPlayer* InContext, double& OutValue) const override { return GetTypedValue(InContext, OutValue); }
+	virtual bool TryGetValue(ULocalPlayer* InContext, FLinearColor& OutValue) const override { return GetTypedValue(InContext, OutValue); }
+	virtual bool TryGetValue(ULocalPlayer* InContext, FVector2D& OutValue) const override { return GetTypedValue(InContext, OutValue); }
+
+	virtual bool TrySetValue(ULocalPlayer* InContext, bool InValue) override { return SetTypedValue(InContext, InValue); }
+	virtual bool TrySetValue(ULocalPlayer* InContext, int64 InValue) override { return SetTypedValue(InContext, InValue); }
+	virtual bool TrySetValue(ULocalPlayer* InContext, double InValue) override { return SetTypedValue(InContext, InValue); }
+	virtual bool TrySetValue(ULocalPlayer* InContext, const FLinearColor& InValue) override { return SetTypedValue(InContext, InValue); }
+	virtual bool TrySetValue(ULocalPlayer* InContext, const FVector2D& InValue) override { return SetTypedValue(InContext, InValue); }
+
+	virtual FString ToString() const override { return Name; }
+
+private:
+	template<typename ChannelType>
+	bool GetTypedValue(ULocalPlayer* InContext, ChannelType& OutValue) const
+	{
+		if constexpr (std::is_same_v<ChannelType, GameSettingDataSourceNative::TTypedChannel<ValueType>>)
+		{
+			const OwnerType* Owner = OwnerAccessor(InContext);
+			if (Owner && Getter)
+			{
+				OutValue = (ChannelType)Getter(*Owner);
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	template<typename ChannelType>
+	bool SetTypedValue(ULocalPlayer* InContext, const ChannelType& InValue)
+	{
+		if constexpr (std::is_same_v<ChannelType, GameSettingDataSourceNative::TTypedChannel<ValueType>>)
+		{
+			OwnerType* Owner = OwnerAccessor(InContext);
+			if (Owner && Setter)
+			{
+				Setter(*Owner, (ValueType)InValue);
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	FOwnerAccessor OwnerAccessor;
+	FGetter Getter;
+	FSetter Setter;
+	FString Name;
+};
+
+/** Makes a data source that reads the setting with a const member function of OwnerType (or one of its bases). */
+template<typename OwnerType, typename MemberOwnerType, typename ReturnType>
+TSharedRef<FGameSettingDataSource> MakeGameSettingDataSourceNative(TIdentity_T<TFunction<OwnerType*(ULocalPlayer*)>> OwnerAccessor, ReturnType (MemberOwnerType::*Getter)() const, FString Name)
+{
+	static_assert(std::is_base_of_v<MemberOwnerType, OwnerType>, "The getter must be a member of the owner type.");
+
+	using ValueType = std::decay_t<ReturnType>;
+	return MakeShared<TGameSettingDataSourceNative<OwnerType, ValueType>>(
+		MoveTemp(OwnerAccessor),
+		[Getter](const OwnerType& Owner) -> ValueType { return (Owner.*Getter)(); },
+		nullptr,
+		MoveTemp(Name));
+}
+
+/** Makes a data source that writes the setting with a single parameter member function of OwnerType (or one of its bases). */
+template<typename OwnerType, typename MemberOwnerType, typename ParamType>
+TSharedRef<FGameSettingDataSource> MakeGameSettingDataSourceNative(TIdentity_T<TFunction<OwnerType*(ULocalPlayer*)>> OwnerAccessor, void (MemberOwnerType::*Setter)(ParamType), FString Name)
+{
+	static_assert(std::is_base_of_v<MemberOwnerType, OwnerType>, "The setter must be a member of the owner type.");
+
+	using ValueType = std::decay_t<ParamType>;
+	return MakeShared<TGameSettingDataSourceNative<OwnerType, ValueType>>(
+		MoveTemp(OwnerAccessor),
+		nullptr,
+		[Setter](OwnerType& Owner, const ValueType& Value) { (Owner.*Setter)(Value); },
+		MoveTemp(Name));
+}
@@ -7,8 +7,10 @@
 class FWhenCondition : public FGameSettingEditCondition
 {
 public:
-	FWhenCondition(TFunction<void(const ULocalPlayer* InLocalPlayer, FGameSettingEditableState&)>&& InInlineEditCondition)
+	/** Inline conditions can read anything, so they're volatile unless they say otherwise, see IsVolatile. */
+	FWhenCondition(TFunction<void(const ULocalPlayer* InLocalPlayer, FGameSettingEditableState&)>&& InInlineEditCondition, bool bInVolatile = true)
 		: InlineEditCondition(InInlineEditCondition)
+		, bVolatile(bInVolatile)
 	{
 	}
 
@@ -22,6 +24,12 @@ public:
 		return TEXT("Inline Edit Condition");
 	}
 
+	virtual bool IsVolatile() const override
+	{
+		return bVolatile;
+	}
+
 private:
 	TFunction<void(const ULocalPlayer* InLocalPlayer, FGameSettingEditableState& InOutEditState)> InlineEditCondition;
+	bool bVolatile;
 };
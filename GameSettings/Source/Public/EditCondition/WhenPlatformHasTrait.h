@@ -8,6 +8,7 @@
 #define UE_API GAMESETTINGS_API
 
 class ULocalPlayer;
+class UCommonUIVisibilitySubsystem;
 
 //////////////////////////////////////////////////////////////////////
 // FWhenPlatformHasTrait
@@ -24,10 +25,16 @@ public:
 	static UE_API TSharedRef<FWhenPlatformHasTrait> DisableIfPresent(FGameplayTag InVisibilityTag, const FText& InDisableReason);
 
 	//~FGameSettingEditCondition interface
+	UE_API virtual void Initialize(const ULocalPlayer* InLocalPlayer) override;
 	UE_API virtual void GatherEditState(const ULocalPlayer* InLocalPlayer, FGameSettingEditableState& InOutEditState) const override;
 	//~End of FGameSettingEditCondition interface
 
 private:
+	UE_API void HandleVisibilityTagsChanged(UCommonUIVisibilitySubsystem* InVisibilitySubsystem);
+
+	/** The subsystem we listen to for trait changes, the same condition is usually shared by many settings. */
+	TWeakObjectPtr<UCommonUIVisibilitySubsystem> BoundVisibilitySubsystem;
+
 	FGameplayTag VisibilityTag;
 	bool bTagDesired;
 	FString KillReason;
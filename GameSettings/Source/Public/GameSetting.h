@@ -11,6 +11,7 @@
 
 #define UE_API GAMESETTINGS_API
 
+class FGameSettingStartupProvider;
 class ULocalPlayer;
 class UGameSettingRegistry;
 
@@ -35,11 +36,15 @@ public:
 	DECLARE_EVENT_TwoParams(UGameSetting, FOnSettingChanged, UGameSetting* /*InSetting*/, EGameSettingChangeReason /*InChangeReason*/);
 	DECLARE_EVENT_OneParam(UGameSetting, FOnSettingApplied, UGameSetting* /*InSetting*/);
 	DECLARE_EVENT_OneParam(UGameSetting, FOnSettingEditConditionChanged, UGameSetting* /*InSetting*/);
+	DECLARE_EVENT_OneParam(UGameSetting, FOnSettingReady, UGameSetting* /*InSetting*/);
 
 	FOnSettingChanged OnSettingChangedEvent;
 	FOnSettingApplied OnSettingAppliedEvent;
 	FOnSettingEditConditionChanged OnSettingEditConditionChangedEvent;
 
+	/** Broadcast once the setting finishes its startup, see IsReady. */
+	FOnSettingReady OnSettingReadyEvent;
+
 public:
 
 	/**
@@ -77,9 +82,28 @@ public:
 
 	void SetRegistry(UGameSettingRegistry* InOwningRegistry) { OwningRegistry = InOwningRegistry; }
 
+	/**
+	 * Tells the registry what has to be applied when this setting changes, see UGameSettingRegistry::SaveChanges.
+	 * Settings without any categories take the categories of the nearest collection above them that has some.
+	 */
+	void AddApplyCategory(const FName& InCategory) { ApplyCategories.AddUnique(InCategory); }
+	TConstArrayView<FName> GetApplyCategories() const { return ApplyCategories; }
+
+	/** Gets our apply categories, or the nearest parent's if we don't have any.  Empty if nothing above us has any either. */
+	UE_API TConstArrayView<FName> FindEffectiveApplyCategories() const;
+
 	/** Gets the searchable plain text for the description. */
 	UE_API const FString& GetDescriptionPlainText() const;
 
+	/** Changes whenever the searchable text of this setting may have changed. */
+	uint32 GetSearchableTextVersion() const { return SearchableTextVersion; }
+
+	/** Changes whenever the searchable text of any setting may have changed. */
+	static UE_API uint32 GetSearchableTextEpoch();
+
+	/** Regenerates the searchable text of every setting the next time it's needed, e.g. because the culture changed. */
+	static UE_API void InvalidateAllSearchableText();
+
 	/** Initializes the setting, giving it the owning local player.  Containers automatically initialize settings added to them. */
 	UE_API void Initialize(ULocalPlayer* InLocalPlayer);
 
@@ -110,12 +134,34 @@ public:
 	 */
 	const FGameSettingEditableState& GetEditState() const { return EditableStateCache; }
 
+	/** Bumped whenever the edit state's disabled discrete options change. */
+	uint32 GetDisabledOptionsEpoch() const { return DisabledOptionsEpoch; }
+
 	/** Adds a new edit condition to this setting, allowing you to control the visibility and edit-ability of this setting. */
 	UE_API void AddEditCondition(const TSharedRef<FGameSettingEditCondition>& InEditCondition);
 
-	/** Add setting dependency, if these settings change, we'll re-evaluate edit conditions for this setting. */
+	/** Gets the edit conditions added with AddEditCondition. */
+	TConstArrayView<TSharedRef<FGameSettingEditCondition>> GetEditConditions() const { return EditConditions; }
+
+	/**
+	 * Add setting dependency, if these settings change, we'll re-evaluate edit conditions for this setting.  The registry
+	 * compiles the dependencies between its settings when they're registered, see FGameSettingEditDependencyGraph,
+	 * dependencies outside of a registry are still handled as soon as the dependency changes.
+	 */
 	UE_API void AddEditDependency(UGameSetting* DependencySetting);
 
+	/** Gets the settings added with AddEditDependency. */
+	const TArray<TObjectPtr<UGameSetting>>& GetEditDependencies() const { return EditDependencies; }
+
+	/** Removes every setting added with AddEditDependency, we'll no longer re-evaluate edit conditions when they change. */
+	UE_API void ClearEditDependencies();
+
+	/**
+	 * Called by the registry once per change, after any of our edit dependencies changed.  Only settings that depend on
+	 * a changed value directly announce that they changed too, anything further along only refreshes its edit state.
+	 */
+	UE_API void HandleEditDependenciesChanged(bool bNotifySettingChanged);
+
 	/** The parent object that owns the setting, in most cases the collection, but for top level settings the registry. */
 	UE_API void SetSettingParent(UGameSetting* InSettingParent);
 	UGameSetting* GetSettingParent() const { return SettingParent; }
@@ -127,12 +173,32 @@ public:
 	/** Gets the analytics value for this setting. */
 	virtual FString GetAnalyticsValue() const { return TEXT(""); }
 
+	/**
+	 * When the registry regenerates incrementally, an existing setting with the same DevName is kept in place of the
+	 * freshly built one if this returns true.  Override if settings of the same class can differ in ways that matter.
+	 */
+	virtual bool CanBeReusedFor(const UGameSetting& InReplacement) const { return GetClass() == InReplacement.GetClass(); }
+
+	/**
+	 * Called on a setting kept in place of a freshly built one, so it takes on everything the fresh build decided:
+	 * texts, tags, edit conditions, and in subclasses data sources and options.  Edit dependencies are rebound by the
+	 * registry.  Subclasses with their own build time state should override this and call Super.
+	 */
+	UE_API virtual void CopyDefinitionFrom(const UGameSetting& InFreshSetting);
+
 	/**
 	 * Some settings may take an async amount of time to finish initializing.  The settings system will wait
 	 * for all settings to be ready before showing the setting.
 	 */
 	bool IsReady() const { return bReady; }
 
+	/**
+	 * Makes the setting wait for the provider's data before it starts up, so settings that need the same data share
+	 * a single fetch, see FGameSettingStartupScheduler.  Must be called before the setting is initialized.
+	 */
+	UE_API void AddStartupProvider(const TSharedRef<FGameSettingStartupProvider>& InProvider);
+	TConstArrayView<TSharedRef<FGameSettingStartupProvider>> GetStartupProviders() const { return StartupProviders; }
+
 	/**
 	 * Any setting can have children, this is so we can allow for the possibility of "collections" or "actions" that
 	 * are not directly visible to the user, but are set by some means and need to have initial and restored values.
@@ -147,6 +213,29 @@ public:
 	 */
 	UE_API void RefreshEditableState(bool bNotifyEditConditionsChanged = true);
 
+	/**
+	 * Like RefreshEditableState, but only re-gathers the edit state if any of its inputs changed since it was last
+	 * gathered: this setting's changes, its edit dependencies, its edit conditions' broadcasts, the local player and
+	 * whether they're the primary player, or InvalidateAllEditableStates.  Settings with volatile edit conditions
+	 * always re-gather, see FGameSettingEditCondition::IsVolatile.  Doesn't notify if nothing changed.
+	 */
+	UE_API void RefreshEditableStateIfStale(bool bNotifyEditConditionsChanged = true);
+
+	/** Forces every setting to re-gather its edit state on the next RefreshEditableStateIfStale. */
+	static UE_API void InvalidateAllEditableStates();
+
+	/** Changes whenever any setting becomes visible, hidden, enabled, disabled, resetable or not, everything filtering looks at. */
+	static UE_API uint32 GetFilterableStateEpoch();
+
+	struct FEditableStateCacheStats
+	{
+		uint64 Hits = 0;
+		uint64 Misses = 0;
+	};
+
+	/** How often RefreshEditableStateIfStale could reuse the cached edit state, across every setting. */
+	static UE_API FEditableStateCacheStats& GetEditableStateCacheStats();
+
 	/**
 	 * We expect settings to change the live value immediately, but occasionally there are special settings
 	 * that go are immediately stored to a temporary location but we don't actually apply them until later
@@ -165,18 +254,22 @@ protected:
 	UE_API virtual void OnInitialized();
 	UE_API virtual void OnApply();
 	UE_API virtual void OnGatherEditState(FGameSettingEditableState& InOutEditState) const;
+
+	/** The option values FGameSettingEditableState::DisableOption refers to, for settings with discrete options. */
+	virtual TConstArrayView<FString> GetEditStateOptionValues() const { return TConstArrayView<FString>(); }
 	UE_API virtual void OnDependencyChanged();
 
 	/**  */
 	UE_API virtual FText GetDynamicDetailsInternal() const;
 
-	/** */
+	/** Handles dependencies the registry doesn't compile into its graph, see AddEditDependency. */
 	UE_API void HandleEditDependencyChanged(UGameSetting* DependencySetting, EGameSettingChangeReason Reason);
 	UE_API void HandleEditDependencyChanged(UGameSetting* DependencySetting);
+	bool IsEditDependencyInRegistryGraph(const UGameSetting* DependencySetting) const { return OwningRegistry && DependencySetting->OwningRegistry == OwningRegistry; }
 
 	/** Regenerates the plain searchable text if it has been dirtied. */
 	UE_API void RefreshPlainText() const;
-	void InvalidateSearchableText() { bRefreshPlainSearchableText = true; }
+	UE_API void InvalidateSearchableText();
 
 	/** Notify that the setting changed */
 	UE_API void NotifySettingChanged(EGameSettingChangeReason Reason);
@@ -189,6 +282,9 @@ protected:
 	/**  */
 	UE_API FGameSettingEditableState ComputeEditableState() const;
 
+	/** Marks the edit state stale, for settings that change something their edit state depends on without notifying a change. */
+	void InvalidateEditableState() { ChangeEpoch++; }
+
 protected:
 
 	UPROPERTY(Transient)
@@ -209,29 +305,25 @@ protected:
 	/** A collection of tags for the settings.  These can just be arbitrary flags used by the UI to do different things. */
 	FGameplayTagContainer Tags;
 
+	/** What has to be applied when this setting changes, see AddApplyCategory. */
+	TArray<FName> ApplyCategories;
+
 	FGetGameSettingsDetails DynamicDetails;
 
 	/** Any edit conditions for this setting. */
 	TArray<TSharedRef<FGameSettingEditCondition>> EditConditions;
 
-	class FStringCultureCache
-	{
-		FStringCultureCache(TFunction<FString()> InStringGetter);
-
-		void Invalidate();
-
-		FString Get() const;
-
-	private:
-		mutable FString StringCache;
-		mutable FCultureRef Culture;
-		TFunction<FString()> StringGetter;
-	};
+	/** The settings we re-evaluate edit conditions for when they change. */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UGameSetting>> EditDependencies;
 
 	/** When the text changes, we invalidate the searchable text. */
 	mutable bool bRefreshPlainSearchableText = true;
 	/** When we set the rich text for a setting, we automatically generate the plain text. */
 	mutable FString AutoGenerated_DescriptionPlainText;
+	/** The culture the plain text was generated for, see InvalidateAllSearchableText. */
+	mutable uint32 PlainTextCultureEpoch = 0;
+	uint32 SearchableTextVersion = 0;
 
 	/** Report as part of analytics, by default no setting reports, except GameSettingValues. */
 	bool bReportAnalytics = false;
@@ -250,8 +342,33 @@ private:
 	/**  */
 	bool bAdjustListViewPostRefresh = true;
 
+	/** The providers this setting waits for before it starts up. */
+	TArray<TSharedRef<FGameSettingStartupProvider>> StartupProviders;
+
+	/** Starts up settings once their startup providers are ready. */
+	friend class FGameSettingStartupScheduler;
+
 	/** We cache the editable state of a setting when it changes rather than reprocessing it any time it's needed.  */
 	FGameSettingEditableState EditableStateCache;
+
+	/** The epochs of everything the edit state is gathered from, compared one by one to tell if the cached state is stale. */
+	using FEditableStateInputs = TArray<uint32, TInlineAllocator<8>>;
+	UE_API void GatherEditableStateInputs(FEditableStateInputs& OutInputs) const;
+	UE_API bool HasVolatileEditConditions() const;
+	UE_API void UpdateEditableStateCache();
+
+	/** Bumped whenever this setting changes, or its local player does. */
+	uint32 ChangeEpoch = 0;
+
+	/** Bumped whenever this setting re-gathers its edit state, so dependents know to as well. */
+	uint32 EditStateEpoch = 0;
+
+	/** Bumped whenever a re-gathered edit state disables different options. */
+	uint32 DisabledOptionsEpoch = 0;
+
+	/** The inputs the cached edit state was gathered from. */
+	FEditableStateInputs EditableStateCacheInputs;
+	bool bEditableStateCacheForPrimaryPlayer = false;
 };
 
 #undef UE_API
@@ -56,6 +56,9 @@ public:
 
 	UE_API virtual void ExecuteAction();
 
+	/** UGameSetting */
+	UE_API virtual void CopyDefinitionFrom(const UGameSetting& InFreshSetting) override;
+
 protected:
 	/** UGameSettingValue */
 	UE_API virtual void OnInitialized() override;
@@ -0,0 +1,52 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Algo/Sort.h"
+#include "Containers/Set.h"
+#include "Containers/UnrealString.h"
+#include "UObject/NameTypes.h"
+
+//--------------------------------------
+// FGameSettingApplyCategories
+//--------------------------------------
+
+/**
+ * The apply categories of the settings that changed, see UGameSetting::AddApplyCategory.  Registries use them to only
+ * run the apply paths the changes need.  A changed setting without any category could touch anything, so it makes
+ * every category dirty.
+ */
+struct FGameSettingApplyCategories
+{
+public:
+	/** Every category is dirty, for saving without knowing what changed. */
+	static FGameSettingApplyCategories All()
+	{
+		FGameSettingApplyCategories Result;
+		Result.bAll = true;
+		return Result;
+	}
+
+	void Add(const FName& InCategory) { Categories.Add(InCategory); }
+	void AddAll() { bAll = true; }
+
+	bool Contains(const FName& InCategory) const { return bAll || Categories.Contains(InCategory); }
+	bool IsAll() const { return bAll; }
+	bool IsEmpty() const { return !bAll && Categories.Num() == 0; }
+
+	FString ToString() const
+	{
+		if (bAll)
+		{
+			return TEXT("All");
+		}
+
+		TArray<FName> SortedCategories = Categories.Array();
+		Algo::Sort(SortedCategories, FNameLexicalLess());
+		return FString::JoinBy(SortedCategories, TEXT(", "), [](const FName& Category) { return Category.ToString(); });
+	}
+
+private:
+	TSet<FName> Categories;
+	bool bAll = false;
+};
@@ -26,6 +26,9 @@ public:
 	UE_API TArray<UGameSettingCollection*> GetChildCollections() const;
 
 	UE_API void AddSetting(UGameSetting* Setting);
+
+	/** Replaces all the settings in this collection, taking ownership of them even if they had another parent. */
+	UE_API void SetSettings(const TArray<UGameSetting*>& InSettings);
 	UE_API virtual void GetSettingsForFilter(const FGameSettingFilterState& FilterState, TArray<UGameSetting*>& InOutSettings) const;
 
 	virtual bool IsSelectable() const { return false; }
@@ -0,0 +1,71 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Containers/Array.h"
+#include "Containers/ArrayView.h"
+#include "Containers/Map.h"
+#if !UE_BUILD_SHIPPING
+#include "Containers/Set.h"
+#endif
+#include "UObject/ObjectKey.h"
+#include "UObject/ObjectPtr.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+#define UE_API GAMESETTINGS_API
+
+class UGameSetting;
+
+//--------------------------------------
+// FGameSettingEditDependencyGraph
+//--------------------------------------
+
+/**
+ * The edit dependencies of a registry's settings, see UGameSetting::AddEditDependency, compiled so that a change
+ * re-evaluates every affected setting exactly once, dependencies before dependents.  Settings that depend on each
+ * other form a cycle, and everything in a cycle is evaluated together, in the order it was registered.
+ *
+ * The graph only holds weak references, settings that have been destroyed since it was compiled are skipped, but it
+ * must still be recompiled whenever the registered settings change.
+ */
+class FGameSettingEditDependencyGraph
+{
+public:
+	/** Compiles the graph from the edit dependencies of the provided settings. */
+	UE_API void Compile(TConstArrayView<TObjectPtr<UGameSetting>> InSettings);
+
+	UE_API void Reset();
+
+	/** Does anything depend on this setting. */
+	UE_API bool HasDependents(const UGameSetting* InSetting) const;
+
+	/**
+	 * Gathers every setting that depends on any of the changed settings, directly or through other settings, in the
+	 * order they should be re-evaluated.  Changed settings are only included if they're part of a cycle.
+	 */
+	UE_API void GatherAffectedSettings(TConstArrayView<UGameSetting*> ChangedSettings, TArray<UGameSetting*>& OutAffectedSettings) const;
+
+private:
+	struct FNode
+	{
+		TWeakObjectPtr<UGameSetting> Setting;
+
+		/** The nodes that depend on this one. */
+		TArray<int32> Dependents;
+
+		/** Where this node is evaluated, every node in the same cycle shares the same order. */
+		int32 Order = INDEX_NONE;
+	};
+
+	UE_API int32 FindOrAddNode(UGameSetting* InSetting);
+
+	TArray<FNode> Nodes;
+	TMap<TObjectKey<UGameSetting>, int32> NodeIndices;
+
+#if !UE_BUILD_SHIPPING
+	/** The cycles we've already warned about, so recompiling doesn't report them again. */
+	TSet<FString> ReportedCycles;
+#endif
+};
+
+#undef UE_API
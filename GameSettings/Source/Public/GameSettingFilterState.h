@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include "Containers/BitArray.h"
 #include "Misc/TextFilterExpressionEvaluator.h"
 
 #include "UObject/ObjectPtr.h"
@@ -48,40 +49,67 @@ public:
 
 public:
 	UE_API void SetSearchText(const FString& InSearchText);
+	FText GetSearchText() const { return SearchTextEvaluator.GetFilterText(); }
 
 	UE_API bool DoesSettingPassFilter(const UGameSetting& InSetting) const;
 
+	/**
+	 * DoesSettingPassFilter is split in two: everything but the search text, and the search text against the
+	 * setting's searchable text.  Only the search text test is safe to run off the game thread.
+	 */
+	UE_API bool DoesSettingPassFilterIgnoringText(const UGameSetting& InSetting) const;
+	UE_API bool DoesTextPassFilter(const FString& InSearchableText) const;
+
 	UE_API void AddSettingToRootList(UGameSetting* InSetting);
 	UE_API void AddSettingToAllowList(UGameSetting* InSetting);
 
 	bool IsSettingInAllowList(const UGameSetting* InSetting) const
 	{
-		return SettingAllowList.Contains(InSetting);
+		return SettingAllowSet.Contains(InSetting);
 	}
 	
+	/** Does the other filter state filter settings exactly the same way. */
+	UE_API bool IsSameFilter(const FGameSettingFilterState& Other) const;
+	friend UE_API uint32 GetTypeHash(const FGameSettingFilterState& FilterState);
+
 	const TArray<UGameSetting*>& GetSettingRootList() const { return SettingRootList; }
 	bool IsSettingInRootList(const UGameSetting* InSetting) const
 	{
-		return SettingRootList.Contains(InSetting);
+		return SettingRootSet.Contains(InSetting);
 	}
 
 private:
+	friend class UGameSettingRegistry;
+
 	FTextFilterExpressionEvaluator SearchTextEvaluator;
 
+	/** While the registry filters its settings, the only settings the search text could match, see FGameSettingSearchIndex. */
+	mutable const TSet<const UGameSetting*>* SearchCandidates = nullptr;
+
 	UPROPERTY()
 	TArray<TObjectPtr<UGameSetting>> SettingRootList;
 
 	// If this is non-empty, then only settings in here are allowed
 	UPROPERTY()
 	TArray<TObjectPtr<UGameSetting>> SettingAllowList;
+
+	// The same settings as the lists above, for constant time lookups.  The lists keep them alive, and the root order.
+	TSet<const UGameSetting*> SettingRootSet;
+	TSet<const UGameSetting*> SettingAllowSet;
 };
 
 /**
  * Editable state captures the current visibility and enabled state of a setting. As well
  * as the reasons it got into that state.
+ *
+ * Almost every setting is simply visible and enabled, so that case needs no heap memory: the first reason is stored
+ * inline, and disabled options are a bitmask over the setting's option indices.
  */
 class FGameSettingEditableState
 {
+	friend class UGameSetting;
+	friend class FGameSettingEditConditionCacheScope;
+
 public:
 	FGameSettingEditableState()
 		: bVisible(true)
@@ -95,13 +123,20 @@ public:
 	bool IsEnabled() const { return bEnabled; }
 	bool IsResetable() const { return bResetable; }
 	bool IsHiddenFromAnalytics() const { return bHideFromAnalytics; }
-	const TArray<FText>& GetDisabledReasons() const { return DisabledReasons; }
+	TConstArrayView<FText> GetDisabledReasons() const { return DisabledReasons; }
 
 #if !UE_BUILD_SHIPPING
-	const TArray<FString>& GetHiddenReasons() const { return HiddenReasons; }
+	TConstArrayView<FString> GetHiddenReasons() const { return HiddenReasons; }
 #endif
 
-	const TArray<FString>& GetDisabledOptions() const { return DisabledOptions; }
+	/** Are any of the setting's discrete options disabled. */
+	bool HasDisabledOptions() const { return DisabledOptions.Contains(true); }
+
+	/** Is the discrete option at this index disabled, see DisableOption. */
+	bool IsOptionDisabled(int32 OptionIndex) const { return DisabledOptions.IsValidIndex(OptionIndex) && DisabledOptions[OptionIndex]; }
+
+	/** Do both states disable the same discrete options. */
+	bool HasSameDisabledOptions(const FGameSettingEditableState& Other) const { return DisabledOptions == Other.DisabledOptions; }
 
 	/** Hides the setting, you don't have to provide a user facing reason, but you do need to specify a developer reason. */
 	UE_API void Hide(const FString& DevReason);
@@ -137,18 +172,25 @@ public:
 		UnableToReset();
 	}
 
+	/** Combines another state into this one, as if whatever gathered it had gathered into this state instead. */
+	UE_API void Append(const FGameSettingEditableState& Other);
+
 private:
 	uint8 bVisible : 1;
 	uint8 bEnabled : 1;
 	uint8 bResetable : 1;
 	uint8 bHideFromAnalytics : 1;
 
-	TArray<FString> DisabledOptions;
+	/** Indexed by the setting's option index. */
+	TBitArray<TInlineAllocator<2>> DisabledOptions;
+
+	/** The setting's option values, so DisableOption can find their index.  Only set while the state is being gathered. */
+	TConstArrayView<FString> OptionValues;
 
-	TArray<FText> DisabledReasons;
+	TArray<FText, TInlineAllocator<1>> DisabledReasons;
 
 #if !UE_BUILD_SHIPPING
-	TArray<FString> HiddenReasons;
+	TArray<FString, TInlineAllocator<1>> HiddenReasons;
 #endif
 };
 
@@ -168,9 +210,23 @@ public:
 	/** Broadcasts Event*/
 	void BroadcastEditConditionChanged()
 	{
+		BroadcastCount++;
 		OnEditConditionChangedEvent.Broadcast(true);
 	}
 
+	/**
+	 * How many times this condition has broadcast OnEditConditionChangedEvent.  Settings only re-gather a cached edit
+	 * state when this changes, so conditions depending on anything besides the setting, its edit dependencies and
+	 * the local player need to broadcast when it changes.
+	 */
+	uint32 GetBroadcastCount() const { return BroadcastCount; }
+
+	/**
+	 * Does this condition read state that can change without it broadcasting, like the safe zone or the audio output
+	 * device.  Settings never reuse an edit state gathered from a volatile condition.
+	 */
+	virtual bool IsVolatile() const { return false; }
+
 	/** Called during the setting Initialization */
 	virtual void Initialize(const ULocalPlayer* InLocalPlayer)
 	{
@@ -196,6 +252,37 @@ public:
 
 	/** Generate useful debugging text for this edit condition.  Helpful when things don't work as expected. */
 	virtual FString ToString() const { return TEXT(""); }
+
+private:
+	uint32 BroadcastCount = 0;
+};
+
+/**
+ * While in scope, each edit condition is only gathered once per local player, and the result is reused by every
+ * setting the condition is attached to.  Conditions like FWhenPlayingAsPrimaryPlayer or platform traits are shared
+ * by many settings.  Only use this around passes that refresh edit states without changing anything the conditions
+ * read, a condition broadcasting OnEditConditionChangedEvent still invalidates its result.  Scopes can nest.
+ */
+class FGameSettingEditConditionCacheScope : public FNoncopyable
+{
+public:
+	UE_API FGameSettingEditConditionCacheScope();
+	UE_API ~FGameSettingEditConditionCacheScope();
+
+	/** Gathers the condition into the edit state, reusing its result from earlier in the active scope if there is one. */
+	static UE_API void GatherEditState(const FGameSettingEditCondition& InEditCondition, const ULocalPlayer* InLocalPlayer, FGameSettingEditableState& InOutEditState);
+
+private:
+	struct FCachedResult
+	{
+		uint32 BroadcastCount = 0;
+		FGameSettingEditableState EditState;
+	};
+
+	TMap<TPair<const FGameSettingEditCondition*, const ULocalPlayer*>, FCachedResult> CachedResults;
+
+	/** The outermost scope, which owns the cache. */
+	static UE_API FGameSettingEditConditionCacheScope* ActiveScope;
 };
 
 #undef UE_API
@@ -0,0 +1,94 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Containers/Array.h"
+#include "Containers/ArrayView.h"
+#include "Containers/Map.h"
+#include "UObject/ObjectPtr.h"
+
+#define UE_API GAMESETTINGS_API
+
+class UGameSetting;
+class UGameSettingCollection;
+struct FGameSettingFilterState;
+
+//--------------------------------------
+// FGameSettingFlatTree
+//--------------------------------------
+
+/**
+ * The registry's setting tree flattened in preorder, one array per field, so filtering the whole tree is a scan over
+ * contiguous memory instead of recursing through each collection's children with a cast per child.  Every setting's
+ * subtree is the range from its index up to its subtree end.
+ *
+ * Filtering matches UGameSettingCollection::GetSettingsForFilter and UGameSettingCollectionPage's override exactly,
+ * collections of any other native class are filtered through their own GetSettingsForFilter, since they may override
+ * it.  The tree doesn't keep the settings alive, it must be rebuilt whenever the registered settings change.
+ */
+class FGameSettingFlatTree
+{
+public:
+	UE_API void Build(TConstArrayView<TObjectPtr<UGameSetting>> InTopLevelSettings);
+	UE_API void Reset();
+
+	int32 Num() const { return Settings.Num(); }
+	int32 FindIndex(const UGameSetting* InSetting) const { return Indices.FindRef(InSetting, INDEX_NONE); }
+
+	/** The number of settings in the subtree at the index, including the setting itself. */
+	int32 GetSubtreeNum(int32 Index) const { return SubtreeEnds[Index] - Index; }
+
+	/**
+	 * Gathers the settings under the root that pass the filter, as if filtering the root setting itself.  With
+	 * bParallelTextFilter, the search text is first tested against a snapshot of the subtree's searchable text with
+	 * ParallelFor, the results are identical and in the same order.
+	 */
+	UE_API void GetSettingsForFilter(const FGameSettingFilterState& FilterState, int32 RootIndex, TArray<UGameSetting*>& InOutSettings, bool bParallelTextFilter = false);
+
+private:
+	enum class EKind : uint8
+	{
+		Setting,
+		Collection,
+		Page,
+		/** Collections and pages with their own GetSettingsForFilter, see HasCustomFilter. */
+		CustomCollection,
+		CustomPage,
+	};
+
+	enum EEditableBits : uint8
+	{
+		Visible = 1 << 0,
+		Enabled = 1 << 1,
+		Resetable = 1 << 2,
+	};
+
+	/** Is the collection's native class anything but UGameSettingCollection or UGameSettingCollectionPage. */
+	static bool HasCustomFilter(const UGameSettingCollection* InCollection);
+
+	UE_API void AddSubtree(UGameSetting* InSetting);
+	UE_API void RefreshEditableBits();
+	UE_API void FilterTextInParallel(const FGameSettingFilterState& FilterState, int32 RootIndex);
+	UE_API void GatherChildrenForFilter(const FGameSettingFilterState& FilterState, int32 CollectionIndex, TArray<UGameSetting*>& InOutSettings) const;
+
+	/** Checks the filter, rejecting on the cached editable bits before looking at the setting itself. */
+	bool DoesSettingPassFilter(const FGameSettingFilterState& FilterState, int32 Index) const;
+
+	TArray<UGameSetting*> Settings;
+	TArray<EKind> Kinds;
+
+	/** One past the last index in each setting's subtree. */
+	TArray<int32> SubtreeEnds;
+
+	/** The visible, enabled and resetable state of each setting, as of EditableBitsEpoch. */
+	TArray<uint8> EditableBits;
+	uint32 EditableBitsEpoch = 0;
+
+	TMap<const UGameSetting*, int32> Indices;
+
+	/** While filtering in parallel, whether each setting from TextFilterResultsBegin on passed the search text. */
+	TArray<uint8> TextFilterResults;
+	int32 TextFilterResultsBegin = INDEX_NONE;
+};
+
+#undef UE_API
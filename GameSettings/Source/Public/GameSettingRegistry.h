@@ -3,7 +3,15 @@
 #pragma once
 
 #include "GameSetting.h"
+#include "GameSettingApplyCategories.h"
+#include "GameSettingEditDependencyGraph.h"
+#include "GameSettingFlatTree.h"
+#include "GameSettingRegistrySnapshot.h"
+#include "GameSettingSearchIndex.h"
+#include "GameSettingStartupScheduler.h"
+#include "Containers/Ticker.h"
 #include "Templates/Casts.h"
+#include "UObject/WeakObjectPtrTemplates.h"
 
 #include "GameSettingRegistry.generated.h"
 
@@ -16,10 +24,14 @@ struct FGameplayTag;
 //--------------------------------------
 
 class ULocalPlayer;
+class UGameSettingRegistryDefinition;
 struct FGameSettingFilterState;
 
 enum class EGameSettingChangeReason : uint8;
 
+/** Builds a top level setting on demand, see UGameSettingRegistry::RegisterLazySetting. */
+DECLARE_DELEGATE_RetVal_OneParam(UGameSetting*, FBuildGameSetting, ULocalPlayer* /*InLocalPlayer*/);
+
 /**
  * 
  */
@@ -42,6 +54,14 @@ public:
 	DECLARE_EVENT_OneParam(UGameSettingRegistry, FOnExecuteNavigation, UGameSetting* /*Setting*/);
 	FOnExecuteNavigation OnExecuteNavigationEvent;
 
+	/** Broadcast when the registry finishes initializing, after the last setting still starting up becomes ready. */
+	DECLARE_EVENT(UGameSettingRegistry, FOnFinishedInitializing);
+	FOnFinishedInitializing OnFinishedInitializingEvent;
+
+	/** Broadcast when the outermost change batch ends, after the deferred events, with every setting that changed during it. */
+	DECLARE_EVENT_OneParam(UGameSettingRegistry, FOnChangeBatchEnded, const TArray<UGameSetting*>& /*ChangedSettings*/);
+	FOnChangeBatchEnded OnChangeBatchEndedEvent;
+
 public:
 	UE_API UGameSettingRegistry();
 
@@ -49,14 +69,62 @@ public:
 
 	UE_API virtual void Regenerate();
 
+	/**
+	 * Rebuilds the settings like Regenerate, but any existing setting whose DevName still exists, and which
+	 * CanBeReusedFor the freshly built one, is kept in its place and takes on the fresh build's definition, see
+	 * UGameSetting::CopyDefinitionFrom.  Anything bound to those settings stays valid, and only the settings that
+	 * disappeared are destroyed.
+	 */
+	UE_API virtual void RegenerateIncremental();
+
 	UE_API virtual bool IsFinishedInitializing() const;
 
-	UE_API virtual void SaveChanges();
+	/** Applies and saves everything, as if every apply category changed. */
+	UE_API void SaveChanges();
+
+	/** Applies and saves what the changes in the dirty apply categories need, see UGameSetting::AddApplyCategory. */
+	UE_API virtual void SaveChanges(const FGameSettingApplyCategories& DirtyCategories);
 	
+	/** Filters the settings under the filter's roots, or every built setting without any roots, lazy settings aren't built for it. */
 	UE_API void GetSettingsForFilter(const FGameSettingFilterState& FilterState, TArray<UGameSetting*>& InOutSettings);
 
+	/**
+	 * Finds a registered setting, building the lazy setting it's in if needed.  A lazy setting is only built for the
+	 * DevNames it declared, see RegisterLazySetting, so looking up anything else never builds one.
+	 */
 	UE_API UGameSetting* FindSettingByDevName(const FName& SettingDevName);
 
+#if !UE_BUILD_SHIPPING
+	/**
+	 * Builds every lazy setting, and writes a snapshot of the whole setting tree, see HasSnapshot.  Only for staging
+	 * snapshots ahead of time with GameSettings.SaveRegistrySnapshots, it defeats building settings on demand.
+	 */
+	UE_API void SaveSnapshot();
+	/** Times filtering the whole setting tree through the flattened tree, serially and in parallel, and by recursing through the collections, see GameSettings.BenchmarkFilter. */
+	UE_API void BenchmarkSettingsForFilter(int32 Iterations, const FString& SearchText);
+
+	/**
+	 * Builds the definition's settings on their own, and describes every way they differ from the registered settings
+	 * with the same DevNames, for checking a definition against the settings it replaces, see GameSettings.CompareRegistryDefinition.
+	 */
+	UE_API void CompareWithDefinition(const UGameSettingRegistryDefinition* InDefinition, TArray<FString>& OutDifferences);
+#endif
+
+	/**
+	 * Starts deferring the registry's own change and edit condition events, for bulk operations like restoring every
+	 * setting to its initial value.  Dependents are re-evaluated once for the whole batch, and when the outermost batch
+	 * ends the registry broadcasts each setting's events once, followed by OnChangeBatchEndedEvent.  Only the registry
+	 * level events are batched, each setting's own OnSettingChangedEvent still fires for every change.  Batches can
+	 * nest, prefer FGameSettingRegistryChangeBatchScope to calling these directly.
+	 */
+	UE_API void BeginChangeBatch();
+	UE_API void EndChangeBatch();
+
+	bool IsInChangeBatch() const { return ChangeBatchDepth > 0; }
+
+	/** Registers a setting added to one of our collections after it was registered, see UGameSettingCollection::AddSetting. */
+	UE_API void RegisterAddedSetting(UGameSetting* InSetting);
+
 	template<typename T = UGameSetting>
 	T* FindSettingByDevNameChecked(const FName& SettingDevName)
 	{
@@ -73,12 +141,52 @@ protected:
 	UE_API void RegisterSetting(UGameSetting* InSetting);
 	UE_API void RegisterInnerSettings(UGameSetting* InSetting);
 
+	/**
+	 * Registers a top level setting that is only built the first time it's looked up by DevName, either its own or
+	 * one of InInnerDevNames, the settings inside it that may be looked up before it's built.  Until then, a
+	 * lightweight collection carrying only the DevName and DisplayName stands in for it.  The builder must return a
+	 * setting with the same DevName.
+	 */
+	UE_API void RegisterLazySetting(const FName& InDevName, const FText& InDisplayName, const FBuildGameSetting& InBuilder, TConstArrayView<FName> InInnerDevNames = {});
+
+	/** Is this a stand in for a top level setting that hasn't been built yet. */
+	bool IsLazySettingPending(const UGameSetting* InSetting) const
+	{
+		return InSetting && LazySettingBuilders.Contains(InSetting->GetDevName()) && RegisteredSettingsByDevName.FindRef(InSetting->GetDevName()) == InSetting;
+	}
+
+	/** Builds any lazy top level setting that hasn't been built yet. */
+	UE_API void BuildAllLazySettings();
+
+	/**
+	 * Registers the settings of a definition asset.  Its top level settings are registered like RegisterSetting, or
+	 * like RegisterLazySetting with bBuildOnDemand, and any other root goes in the registered collection it names.
+	 * Roots whose collection is inside a lazy setting that hasn't been built yet are added once it's built.
+	 */
+	UE_API void RegisterDefinition(const UGameSettingRegistryDefinition* InDefinition, bool bBuildOnDemand = false);
+
+	/**
+	 * Is there a snapshot of this registry's setting tree from an earlier build, see FGameSettingRegistrySnapshot.
+	 * With one, looking up a setting inside a lazy setting only builds the lazy setting it's under, so registries
+	 * can build their settings on demand without paying for it on lookups.
+	 */
+	bool HasSnapshot() const { return !Snapshot.IsEmpty(); }
+
+	/** Bump whenever the settings built by OnInitialize change, so older snapshots are discarded. */
+	virtual uint32 GetSnapshotDefinitionVersion() const { return 0; }
+
+	UE_API virtual FString GetSnapshotFilename() const;
+
 	// Internal event handlers.
 	UE_API void HandleSettingChanged(UGameSetting* Setting, EGameSettingChangeReason Reason);
 	UE_API void HandleSettingApplied(UGameSetting* Setting);
 	UE_API void HandleSettingEditConditionsChanged(UGameSetting* Setting);
 	UE_API void HandleSettingNamedAction(UGameSetting* Setting, FGameplayTag GameSettings_Action_Tag);
 	UE_API void HandleSettingNavigation(UGameSetting* Setting);
+	UE_API void HandleSettingReady(UGameSetting* Setting);
+
+	/** Broadcasts OnFinishedInitializingEvent if IsFinishedInitializing.  Subclasses with extra requirements call this once they're met. */
+	UE_API void BroadcastIfFinishedInitializing();
 
 	UPROPERTY(Transient)
 	TArray<TObjectPtr<UGameSetting>> TopLevelSettings;
@@ -86,8 +194,185 @@ protected:
 	UPROPERTY(Transient)
 	TArray<TObjectPtr<UGameSetting>> RegisteredSettings;
 
+	/** Index of RegisteredSettings by DevName, for constant time lookups and duplicate detection. */
+	UPROPERTY(Transient)
+	TMap<FName, TObjectPtr<UGameSetting>> RegisteredSettingsByDevName;
+
 	UPROPERTY(Transient)
 	TObjectPtr<ULocalPlayer> OwningLocalPlayer;
+
+private:
+	UE_API UGameSetting* BuildLazySetting(UGameSetting* InStub);
+
+	/** The DevName of the unbuilt lazy setting the setting is in, or NAME_None if it's built or unknown.  Never builds anything. */
+	UE_API FName FindPendingLazySetting(const FName& InDevName) const;
+
+	/** Builds a definition root and adds it to its parent collection. */
+	UE_API void AddDefinitionRoot(const UGameSettingRegistryDefinition* InDefinition, int32 RootIndex, UGameSettingCollection* InParentCollection);
+
+	/** Adds the deferred definition roots whose parent collection has been built since they were registered. */
+	UE_API void AddPendingDefinitionRoots();
+
+	/** Swaps reusable settings into a freshly built setting tree, returning the setting to register in its place. */
+	UE_API UGameSetting* ReuseExistingSettings(UGameSetting* InSetting);
+
+	/** Points the edit dependencies of every registered setting at the settings that were actually kept. */
+	UE_API void RebindReusedEditDependencies();
+
+	/** Removes everything RegisterInnerSettings bound on the setting. */
+	UE_API void UnbindSetting(UGameSetting* InSetting);
+
+	/** Filters the root by recursing through its collections, for roots outside the flattened setting tree. */
+	UE_API void GetSettingsForFilterRecursive(const FGameSettingFilterState& FilterState, UGameSetting* InRootSetting, TArray<UGameSetting*>& InOutSettings) const;
+
+	UE_API void RebuildSettingTreeIfStale();
+
+	/**
+	 * If every lazy setting has already been built, writes the snapshot if there isn't one yet, or validates it, see
+	 * GameSettings.ValidateRegistrySnapshot.  Never builds anything itself, and does nothing in shipping builds.
+	 */
+	UE_API void UpdateSnapshotIfComplete();
+
+#if !UE_BUILD_SHIPPING
+	/** Writes a snapshot of the setting tree as it's built right now. */
+	UE_API void WriteSnapshot();
+#endif
+
+	/**
+	 * Generates the searchable plain text of the registered settings from InFirstSettingIndex on, a few at a time, so
+	 * searching never has to.  Started once the registry finishes initializing, and again for settings built later.
+	 */
+	UE_API void StartPlainTextWarmup(int32 InFirstSettingIndex = 0);
+	UE_API void HandleCultureChanged();
+
+	/** Re-evaluates the settings depending on this one once the current change is over, see FGameSettingEditDependencyGraph. */
+	UE_API void QueueEditDependencyChange(UGameSetting* InSetting, bool bValueChanged);
+	UE_API void EvaluateEditDependencies();
+
+	/** Settings from before an incremental regenerate that haven't been reused yet, by DevName. */
+	UPROPERTY(Transient)
+	TMap<FName, TObjectPtr<UGameSetting>> ReusableSettings;
+
+	/** Freshly built settings that were discarded during an incremental regenerate, mapped to the setting reused in their place. */
+	UPROPERTY(Transient)
+	TMap<TObjectPtr<UGameSetting>, TObjectPtr<UGameSetting>> ReplacedSettings;
+
+	/**
+	 * The replaced fresh settings of the last incremental regenerate.  Edit conditions built alongside them may capture
+	 * them, and are copied onto the reused settings, so they're kept until the next regenerate.
+	 */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UGameSetting>> RetiredSettings;
+
+	/** The definitions registered settings were built from, lazy settings may still need them. */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<const UGameSettingRegistryDefinition>> RegisteredDefinitions;
+
+	/** Definition roots whose parent collection is in a lazy setting that hasn't been built yet, see RegisterDefinition. */
+	struct FPendingDefinitionRoot
+	{
+		TWeakObjectPtr<const UGameSettingRegistryDefinition> Definition;
+		int32 RootIndex = INDEX_NONE;
+	};
+
+	TArray<FPendingDefinitionRoot> PendingDefinitionRoots;
+
+	/** Builders for lazy top level settings that haven't been built yet, by DevName. */
+	TMap<FName, FBuildGameSetting> LazySettingBuilders;
+
+	/** The DevName of the lazy setting each declared inner DevName is in, see RegisterLazySetting. */
+	TMap<FName, FName> LazySettingsByInnerDevName;
+
+	/** The number of registered settings that haven't finished their startup yet. */
+	int32 NumSettingsPendingStartup = 0;
+
+	/** Fetches the startup providers of the settings built together once, after they're all registered. */
+	TSharedRef<FGameSettingStartupScheduler> StartupScheduler = MakeShared<FGameSettingStartupScheduler>();
+
+	/** The setting tree as of the last full build, loaded when the registry is initialized. */
+	FGameSettingRegistrySnapshot Snapshot;
+
+	/** Whether the snapshot has been loaded or written since the registry was initialized, it isn't checked again unless validating. */
+	bool bSnapshotUpToDate = false;
+
+	/** Set while OnInitialize is registering the settings. */
+	bool bInOnInitialize = false;
+
+	/** The edit dependencies of the registered settings, recompiled on demand after settings are registered. */
+	FGameSettingEditDependencyGraph EditDependencyGraph;
+	bool bEditDependencyGraphDirty = false;
+
+	/** The searchable text of the registered settings, so searches only test settings that could match. */
+	FGameSettingSearchIndex SearchIndex;
+
+	/** Bumped whenever settings are registered, or the registry is regenerated. */
+	uint32 StructureVersion = 0;
+
+	/** The top level settings and everything under them flattened, as of SettingTreeStructureVersion. */
+	FGameSettingFlatTree SettingTree;
+	uint32 SettingTreeStructureVersion = MAX_uint32;
+
+	/** The results of recent GetSettingsForFilter calls, reused until the filter, the settings or their edit states change. */
+	struct FFilterResult
+	{
+		uint32 FilterHash = 0;
+		FGameSettingFilterState FilterState;
+		uint32 StructureVersion = 0;
+		uint32 FilterableStateEpoch = 0;
+		uint32 SearchableTextEpoch = 0;
+		TArray<UGameSetting*> Settings;
+	};
+
+	TArray<FFilterResult> FilterResultCache;
+	int32 NextFilterResultIndex = 0;
+
+	FTSTicker::FDelegateHandle PlainTextWarmupHandle;
+	int32 NextPlainTextWarmupIndex = 0;
+
+	/** Settings whose dependents still need to be re-evaluated, and whether their value changed or only their edit state. */
+	TArray<TPair<UGameSetting*, bool>> PendingEditDependencyChanges;
+
+	/** Every setting changed or re-evaluated in the current pass, changes they announce during the pass are already handled. */
+	TSet<UGameSetting*> SettingsInEditDependencyPass;
+	bool bEvaluatingEditDependencies = false;
+
+	/** How many change batches are open, see BeginChangeBatch. */
+	int32 ChangeBatchDepth = 0;
+
+	/** Setting changes deferred by the open change batch, with the reason they changed. */
+	TMap<UGameSetting*, EGameSettingChangeReason> BatchedSettingChanges;
+
+	/** Edit condition changes deferred by the open change batch. */
+	TSet<UGameSetting*> BatchedEditConditionChanges;
+};
+
+//--------------------------------------
+// FGameSettingRegistryChangeBatchScope
+//--------------------------------------
+
+/** Batches the change events of a registry for as long as it's in scope, see UGameSettingRegistry::BeginChangeBatch. */
+class FGameSettingRegistryChangeBatchScope : public FNoncopyable
+{
+public:
+	explicit FGameSettingRegistryChangeBatchScope(UGameSettingRegistry* InRegistry)
+		: Registry(InRegistry)
+	{
+		if (InRegistry)
+		{
+			InRegistry->BeginChangeBatch();
+		}
+	}
+
+	~FGameSettingRegistryChangeBatchScope()
+	{
+		if (UGameSettingRegistry* StrongRegistry = Registry.Get())
+		{
+			StrongRegistry->EndChangeBatch();
+		}
+	}
+
+private:
+	TWeakObjectPtr<UGameSettingRegistry> Registry;
 };
 
 #undef UE_API
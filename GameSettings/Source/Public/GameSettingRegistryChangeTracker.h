@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include "GameSettingApplyCategories.h"
 #include "UObject/ObjectKey.h"
 #include "UObject/WeakObjectPtrTemplates.h"
 
@@ -25,7 +26,11 @@ public:
 	UE_API void WatchRegistry(UGameSettingRegistry* InRegistry);
 	UE_API void StopWatchingRegistry();
 
-	UE_API void ApplyChanges();
+	/** Applies every changed setting, returns the apply categories of the settings that changed. */
+	UE_API FGameSettingApplyCategories ApplyChanges();
+
+	/** The apply categories of the settings changed since the dirty state was last cleared, see UGameSetting::AddApplyCategory. */
+	UE_API FGameSettingApplyCategories GetDirtyApplyCategories() const;
 
 	UE_API void RestoreToInitial();
 
@@ -0,0 +1,193 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Engine/DataAsset.h"
+#include "GameplayTagContainer.h"
+#include "UObject/ObjectSaveContext.h"
+
+#include "GameSettingRegistryDefinition.generated.h"
+
+#define UE_API GAMESETTINGS_API
+
+class ULocalPlayer;
+class UGameSetting;
+
+UENUM()
+enum class EGameSettingPlatformTraitCondition : uint8
+{
+	KillIfMissing,
+	DisableIfMissing,
+	KillIfPresent,
+	DisableIfPresent,
+};
+
+/** The display formats of UGameSettingValueScalarDynamic, see FSettingScalarFormatFunction. */
+UENUM()
+enum class EGameSettingScalarFormat : uint8
+{
+	Raw,
+	RawOneDecimal,
+	RawTwoDecimals,
+	ZeroToOnePercent,
+	ZeroToOnePercent_OneDecimal,
+	SourceAsPercent1,
+	SourceAsPercent100,
+	SourceAsInteger,
+};
+
+USTRUCT()
+struct FGameSettingPlatformTraitConditionDefinition
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditAnywhere, Category = Condition)
+	EGameSettingPlatformTraitCondition Condition = EGameSettingPlatformTraitCondition::KillIfMissing;
+
+	UPROPERTY(EditAnywhere, Category = Condition)
+	FGameplayTag PlatformTrait;
+
+	/** Shown to the player when the setting is disabled, and logged when it's killed. */
+	UPROPERTY(EditAnywhere, Category = Condition)
+	FText Reason;
+};
+
+USTRUCT()
+struct FGameSettingOptionDefinition
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditAnywhere, Category = Option)
+	FString Value;
+
+	UPROPERTY(EditAnywhere, Category = Option)
+	FText DisplayText;
+};
+
+/** A single setting, built the same way the registries build their settings in C++. */
+USTRUCT()
+struct FGameSettingDefinition
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditAnywhere, Category = Setting)
+	FName DevName;
+
+	/** The collection this setting goes in, either one from the same definition or one the registry already has.  None for top level settings. */
+	UPROPERTY(EditAnywhere, Category = Setting)
+	FName ParentDevName;
+
+	UPROPERTY(EditAnywhere, Category = Setting)
+	TSubclassOf<UGameSetting> SettingClass;
+
+	UPROPERTY(EditAnywhere, Category = Setting)
+	FText DisplayName;
+
+	UPROPERTY(EditAnywhere, Category = Setting)
+	FText DescriptionRichText;
+
+	/** What the registry has to apply when the setting changes, see UGameSetting::AddApplyCategory. */
+	UPROPERTY(EditAnywhere, Category = Setting)
+	TArray<FName> ApplyCategories;
+
+	/** For dynamic settings, the dot separated path the value is read from, starting at the local player, e.g. GetSharedSettings.GetSubtitlesEnabled. */
+	UPROPERTY(EditAnywhere, Category = Value)
+	FString GetterPath;
+
+	/** For dynamic settings, the dot separated path the value is written to. */
+	UPROPERTY(EditAnywhere, Category = Value)
+	FString SetterPath;
+
+	/** For dynamic settings, the default value as a string, empty for none. */
+	UPROPERTY(EditAnywhere, Category = Value)
+	FString DefaultValue;
+
+	/** For dynamic discrete settings, the options added after any the setting class adds itself. */
+	UPROPERTY(EditAnywhere, Category = Value)
+	TArray<FGameSettingOptionDefinition> Options;
+
+	/** For dynamic scalar settings. */
+	UPROPERTY(EditAnywhere, Category = Value)
+	double ScalarMinimum = 0.0;
+
+	UPROPERTY(EditAnywhere, Category = Value)
+	double ScalarMaximum = 1.0;
+
+	UPROPERTY(EditAnywhere, Category = Value)
+	double ScalarStep = 0.01;
+
+	UPROPERTY(EditAnywhere, Category = Value)
+	EGameSettingScalarFormat ScalarFormat = EGameSettingScalarFormat::ZeroToOnePercent;
+
+	/** Adds FWhenPlayingAsPrimaryPlayer. */
+	UPROPERTY(EditAnywhere, Category = Conditions)
+	bool bPrimaryPlayerOnly = false;
+
+	/** Adds an FWhenPlatformHasTrait for each. */
+	UPROPERTY(EditAnywhere, Category = Conditions)
+	TArray<FGameSettingPlatformTraitConditionDefinition> PlatformTraitConditions;
+
+	/** The DevNames of the settings whose changes re-evaluate this setting's edit conditions, see UGameSetting::AddEditDependency. */
+	UPROPERTY(EditAnywhere, Category = Conditions)
+	TArray<FName> EditDependencies;
+};
+
+//--------------------------------------
+// UGameSettingRegistryDefinition
+//--------------------------------------
+
+/**
+ * Settings described as data, so they can be added to a registry without code, see
+ * UGameSettingRegistry::RegisterDefinition.  Settings are listed parents first, a setting whose parent isn't in the
+ * definition is a root, either a top level setting or one added to a collection the registry already has.
+ *
+ * Where each setting goes is resolved when the asset is saved, so building from a cooked definition is a single
+ * pass over the settings, without any lookups by DevName.
+ */
+UCLASS(MinimalAPI, BlueprintType)
+class UGameSettingRegistryDefinition : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	TConstArrayView<FGameSettingDefinition> GetSettings() const { return Settings; }
+
+	/** The settings whose parents aren't in this definition. */
+	TConstArrayView<int32> GetRootIndices() const { return RootIndices; }
+
+	/**
+	 * Builds the root setting and everything under it, without initializing them.  Edit dependencies on settings
+	 * outside of the root's subtree are found with FindSetting.
+	 */
+	UE_API UGameSetting* BuildSettings(int32 RootIndex, TFunctionRef<UGameSetting*(const FName&)> FindSetting) const;
+
+	//~UObject interface
+	UE_API virtual void PostLoad() override;
+	UE_API virtual void PreSave(FObjectPreSaveContext SaveContext) override;
+#if WITH_EDITOR
+	UE_API virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+	UE_API virtual EDataValidationResult IsDataValid(class FDataValidationContext& Context) const override;
+#endif
+	//~End of UObject interface
+
+protected:
+	/** Resolves where each setting goes, see ParentIndices and RootIndices. */
+	UE_API void RebuildLookupTables();
+
+	UE_API UGameSetting* BuildSetting(const FGameSettingDefinition& Definition) const;
+
+	UPROPERTY(EditDefaultsOnly, Category = Settings, meta = (TitleProperty = "DevName"))
+	TArray<FGameSettingDefinition> Settings;
+
+	/** The index of each setting's parent in Settings, or INDEX_NONE for roots.  Saved with the asset. */
+	UPROPERTY()
+	TArray<int32> ParentIndices;
+
+	UPROPERTY()
+	TArray<int32> RootIndices;
+};
+
+#undef UE_API
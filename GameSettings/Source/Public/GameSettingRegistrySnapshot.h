@@ -0,0 +1,87 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Containers/Array.h"
+#include "Containers/ArrayView.h"
+#include "Containers/Map.h"
+#include "UObject/NameTypes.h"
+#include "UObject/ObjectPtr.h"
+
+#define UE_API GAMESETTINGS_API
+
+class FArchive;
+class UGameSetting;
+
+//--------------------------------------
+// FGameSettingRegistrySnapshot
+//--------------------------------------
+
+/**
+ * The static definition of a registry's setting tree, everything its builder decides that doesn't depend on the
+ * player's values: each setting's DevName and class, where it sits in the tree, its dynamic options, and what its edit
+ * conditions are bound to.  Settings are stored in preorder, each one pointing at its parent.
+ *
+ * Builders bind lambdas and native member functions, so settings can't be recreated from a snapshot.  Instead the
+ * registry uses it to know what a setting tree contains without building it, see UGameSettingRegistry::HasSnapshot.
+ */
+class FGameSettingRegistrySnapshot
+{
+public:
+	struct FEntry
+	{
+		FName DevName;
+		FString ClassPath;
+		int32 ParentIndex = INDEX_NONE;
+
+		/** The options of dynamic discrete settings, by value. */
+		TArray<FString> OptionValues;
+
+		/** The descriptions of the edit conditions, see FGameSettingEditCondition::ToString. */
+		TArray<FString> EditConditions;
+
+		/** The DevNames of the settings added with AddEditDependency. */
+		TArray<FName> EditDependencies;
+
+		friend FArchive& operator<<(FArchive& Ar, FEntry& Entry);
+	};
+
+	/** Captures the setting trees under the top level settings. */
+	UE_API void Capture(TConstArrayView<TObjectPtr<UGameSetting>> InTopLevelSettings, uint32 InDefinitionVersion);
+	UE_API void Reset();
+
+	bool IsEmpty() const { return Entries.Num() == 0; }
+	uint32 GetDefinitionVersion() const { return DefinitionVersion; }
+	TConstArrayView<FEntry> GetEntries() const { return Entries; }
+
+	int32 FindEntryIndex(const FName& InDevName) const { return EntryIndices.FindRef(InDevName, INDEX_NONE); }
+
+	/** The DevName of the top level setting the setting is under, or NAME_None if it isn't in the snapshot. */
+	UE_API FName FindTopLevelDevName(const FName& InDevName) const;
+
+	/** Reads or writes the snapshot, returns false if what's being read isn't a snapshot of the current format. */
+	UE_API bool Serialize(FArchive& Ar);
+
+	UE_API bool SaveToFile(const FString& InFilename);
+
+	/** Loads the snapshot, leaving it empty unless the file was written for this definition version. */
+	UE_API bool LoadFromFile(const FString& InFilename, uint32 InExpectedDefinitionVersion);
+
+	/** Describes every way the other snapshot's definition differs from this one. */
+	UE_API void Diff(const FGameSettingRegistrySnapshot& Other, TArray<FString>& OutDifferences) const;
+
+private:
+	UE_API void AddSubtree(UGameSetting* InSetting, int32 InParentIndex);
+	UE_API void RebuildEntryIndices();
+
+	/** The DevName of the parent of the entry, or NAME_None for top level settings. */
+	FName GetParentDevName(const FEntry& InEntry) const;
+
+	/** Bumped by the registry whenever its builder code changes, see UGameSettingRegistry::GetSnapshotDefinitionVersion. */
+	uint32 DefinitionVersion = 0;
+
+	TArray<FEntry> Entries;
+	TMap<FName, int32> EntryIndices;
+};
+
+#undef UE_API
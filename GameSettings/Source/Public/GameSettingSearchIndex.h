@@ -0,0 +1,78 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Containers/Array.h"
+#include "Containers/ArrayView.h"
+#include "Containers/BitArray.h"
+#include "Containers/Map.h"
+#include "Containers/Set.h"
+#include "Internationalization/CulturePointer.h"
+#include "UObject/ObjectPtr.h"
+
+#define UE_API GAMESETTINGS_API
+
+class UGameSetting;
+
+//--------------------------------------
+// FGameSettingSearchIndex
+//--------------------------------------
+
+/**
+ * An index of the text settings are searched by, see FGameSettingFilterState::SetSearchText, so a search only has to
+ * run the text filter on the settings that could possibly match.
+ *
+ * The text filter matches each search term anywhere in the text, not just at the start of words, so the index maps
+ * every three character sequence of a setting's text to the settings containing it.  A term matches a setting only
+ * if all of its sequences do.  Searches the index can't narrow down, like short terms or filter operators, simply
+ * gather no candidates and every setting is tested as before.
+ *
+ * The index is built for the current culture, and only re-indexes settings whose searchable text was invalidated.
+ * It doesn't keep the settings alive, it must be marked dirty whenever the registered settings change.
+ */
+class FGameSettingSearchIndex
+{
+public:
+	/** The registered settings changed, the index is rebuilt the next time it's used. */
+	void MarkDirty() { bDirty = true; }
+
+	UE_API void Reset();
+
+	/**
+	 * Gathers every setting the search text could match.  Returns false if the search can't be narrowed down by
+	 * the index, in which case every setting needs to be tested.
+	 */
+	UE_API bool GatherCandidates(TConstArrayView<TObjectPtr<UGameSetting>> InSettings, const FString& InSearchText, TSet<const UGameSetting*>& OutCandidates);
+
+private:
+	struct FEntry
+	{
+		const UGameSetting* Setting = nullptr;
+
+		/** The version of the setting's searchable text that was indexed. */
+		uint32 SearchableTextVersion = 0;
+
+		TArray<uint64> Trigrams;
+	};
+
+	UE_API void Rebuild(TConstArrayView<TObjectPtr<UGameSetting>> InSettings);
+	UE_API void UpdateStaleEntries();
+	UE_API void IndexEntry(int32 EntryIndex);
+	UE_API void UnindexEntry(int32 EntryIndex);
+
+	/** Breaks the term into the three character sequences the index is keyed by, returns false if it can't be. */
+	static UE_API bool GatherTrigrams(const FString& InText, TArray<uint64>& OutTrigrams);
+
+	TArray<FEntry> Entries;
+
+	/** The entries containing each three character sequence. */
+	TMap<uint64, TArray<int32>> EntriesByTrigram;
+
+	/** The culture the index was built for, and the global searchable text epoch it's up to date with. */
+	FCulturePtr IndexedCulture;
+	uint32 IndexedSearchableTextEpoch = 0;
+
+	bool bDirty = true;
+};
+
+#undef UE_API
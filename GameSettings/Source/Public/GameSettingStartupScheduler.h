@@ -0,0 +1,121 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Containers/Array.h"
+#include "Containers/Map.h"
+#include "Delegates/Delegate.h"
+#include "Templates/SharedPointer.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+#define UE_API GAMESETTINGS_API
+
+class UGameSetting;
+class ULocalPlayer;
+
+//--------------------------------------
+// FGameSettingStartupProvider
+//--------------------------------------
+
+/**
+ * Fetches data that settings need before they can start up, like the available audio devices or screen resolutions.
+ * Settings declare the providers they need with UGameSetting::AddStartupProvider, and every provider is fetched once
+ * for all the settings starting up together, see FGameSettingStartupScheduler.
+ */
+class FGameSettingStartupProvider : public TSharedFromThis<FGameSettingStartupProvider>
+{
+public:
+	virtual ~FGameSettingStartupProvider() { }
+
+	/** Providers with the same name are the same provider, only the first one a batch sees is fetched. */
+	virtual FName GetProviderName() const = 0;
+
+	/** Starts fetching the data, calling FetchCompleteCallback once it's available.  It may be called immediately. */
+	virtual void Fetch(ULocalPlayer* InLocalPlayer, FSimpleDelegate FetchCompleteCallback) = 0;
+};
+
+//--------------------------------------
+// FGameSettingStartupScheduler
+//--------------------------------------
+
+/**
+ * Starts up settings in batches.  Settings initialized while a batch is open, see FGameSettingStartupBatchScope, wait
+ * for their providers instead of starting up on their own.  When the batch ends each provider they need is fetched
+ * once, and as each provider completes, every setting it was the last one holding back starts up together.
+ *
+ * Settings initialized outside of a batch start up in a batch of their own.
+ */
+class FGameSettingStartupScheduler : public TSharedFromThis<FGameSettingStartupScheduler>
+{
+public:
+	/** How long a provider took to fetch, summed over every time it was fetched. */
+	struct FProviderStats
+	{
+		int32 NumFetches = 0;
+		int32 NumSettingsStarted = 0;
+		double TotalSecondsToReady = 0.0;
+		double MaxSecondsToReady = 0.0;
+	};
+
+	UE_API void BeginBatch(ULocalPlayer* InLocalPlayer);
+	UE_API void EndBatch();
+
+	/** Forgets the settings still waiting for providers, providers already fetching still complete. */
+	UE_API void Reset();
+
+	/** Starts up the setting once its startup providers are ready, on the open batch if there is one. */
+	static UE_API void StartupWhenProvidersReady(UGameSetting* InSetting);
+
+	/** Every provider fetched so far, by name. */
+	static UE_API const TMap<FName, FProviderStats>& GetProviderStats();
+	static UE_API void ResetProviderStats();
+
+private:
+	UE_API void QueueSetting(UGameSetting* InSetting);
+	UE_API void HandleProviderFetched(FName InProviderName);
+
+	struct FPendingProvider
+	{
+		TSharedPtr<FGameSettingStartupProvider> Provider;
+		TArray<TWeakObjectPtr<UGameSetting>> Settings;
+		double FetchStartTime = 0.0;
+		bool bFetching = false;
+	};
+
+	TWeakObjectPtr<ULocalPlayer> LocalPlayer;
+	int32 BatchDepth = 0;
+
+	/** The providers the queued settings are waiting on, by name. */
+	TMap<FName, FPendingProvider> PendingProviders;
+
+	/** How many providers each queued setting is still waiting on. */
+	TMap<TWeakObjectPtr<UGameSetting>, int32> NumProvidersPendingBySetting;
+
+	/** The scheduler with a batch open, settings initialized in the meantime queue on it. */
+	static UE_API FGameSettingStartupScheduler* ActiveScheduler;
+};
+
+//--------------------------------------
+// FGameSettingStartupBatchScope
+//--------------------------------------
+
+/** Keeps a startup batch open for as long as it's in scope, see FGameSettingStartupScheduler. */
+class FGameSettingStartupBatchScope : public FNoncopyable
+{
+public:
+	FGameSettingStartupBatchScope(FGameSettingStartupScheduler& InScheduler, ULocalPlayer* InLocalPlayer)
+		: Scheduler(InScheduler.AsShared())
+	{
+		Scheduler->BeginBatch(InLocalPlayer);
+	}
+
+	~FGameSettingStartupBatchScope()
+	{
+		Scheduler->EndBatch();
+	}
+
+private:
+	TSharedRef<FGameSettingStartupScheduler> Scheduler;
+};
+
+#undef UE_API
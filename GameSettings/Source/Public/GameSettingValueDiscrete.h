@@ -32,7 +32,34 @@ public:
 	UFUNCTION(BlueprintCallable)
 	UE_API virtual TArray<FText> GetDiscreteOptions() const PURE_VIRTUAL(,return TArray<FText>(););
 
+	/**
+	 * The same options as GetDiscreteOptions without copying them, the view stays valid until the options version
+	 * changes.  The default copies GetDiscreteOptions once per version, subclasses that already keep their options
+	 * in an array should return a view of it instead.
+	 */
+	UE_API virtual TConstArrayView<FText> GetDiscreteOptionsView() const;
+
+	/**
+	 * Only ever increases, and does whenever the options may have changed, so callers can hold on to what they built
+	 * from the options until it does.  Only meaningful when AreDiscreteOptionsVersioned, otherwise the options have to
+	 * be read again every time.
+	 */
+	uint32 GetDiscreteOptionsVersion() const { return DiscreteOptionsVersion + GetDisabledOptionsEpoch(); }
+
+	/** Subclasses that call MarkDiscreteOptionsChanged whenever their options change opt in to versioning here. */
+	virtual bool AreDiscreteOptionsVersioned() const { return false; }
+
+	/** Bumps the options version, e.g. when the culture changed and the option texts with it. */
+	void MarkDiscreteOptionsChanged() { DiscreteOptionsVersion++; }
+
 	UE_API virtual FString GetAnalyticsValue() const;
+
+private:
+	uint32 DiscreteOptionsVersion = 0;
+
+	/** Backs the default GetDiscreteOptionsView. */
+	mutable TArray<FText> CachedDiscreteOptions;
+	mutable TOptional<uint32> CachedDiscreteOptionsVersion;
 };
 
 #undef UE_API
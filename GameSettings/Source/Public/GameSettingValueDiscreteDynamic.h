@@ -31,11 +31,16 @@ public:
 	UE_API virtual void ResetToDefault() override;
 	UE_API virtual void RestoreToInitial() override;
 
+	/** UGameSetting */
+	UE_API virtual void CopyDefinitionFrom(const UGameSetting& InFreshSetting) override;
+
 	/** UGameSettingValueDiscrete */
 	UE_API virtual void SetDiscreteOptionByIndex(int32 Index) override;
 	UE_API virtual int32 GetDiscreteOptionIndex() const override;
 	UE_API virtual int32 GetDiscreteOptionDefaultIndex() const override;
 	UE_API virtual TArray<FText> GetDiscreteOptions() const override;
+	UE_API virtual TConstArrayView<FText> GetDiscreteOptionsView() const override;
+	virtual bool AreDiscreteOptionsVersioned() const override { return true; }
 
 	/** UGameSettingValueDiscreteDynamic */
 	UE_API void SetDynamicGetter(const TSharedRef<FGameSettingDataSource>& InGetter);
@@ -47,6 +52,14 @@ public:
 
 	UE_API bool HasDynamicOption(const FString& InOptionValue);
 
+	/** Returns the index of the option with this value, or INDEX_NONE. */
+	UE_API int32 FindDynamicOptionIndex(const FString& InOptionValue) const;
+
+#if !UE_BUILD_SHIPPING
+	/** Times looking up every option of a setting with this many options, hashed and by linear search, see GameSettings.BenchmarkDiscreteOptions. */
+	static UE_API void BenchmarkOptionLookup(int32 NumOptions, int32 Iterations);
+#endif
+
 	UE_API FString GetValueAsString() const;
 	UE_API void SetValueFromString(FString InStringValue);
 
@@ -56,10 +69,65 @@ protected:
 	/** UGameSettingValue */
 	UE_API virtual void OnInitialized() override;
 
+	/** UGameSetting */
+	virtual TConstArrayView<FString> GetEditStateOptionValues() const override { return OptionValues; }
+
 	UE_API void OnDataSourcesReady();
 
 	UE_API bool AreOptionsEqual(const FString& InOptionA, const FString& InOptionB) const;
 
+	/** Removes all the options, subclasses that rebuild their options should use this rather than touching the arrays. */
+	UE_API void ResetDynamicOptions(int32 NewSize = 0);
+
+	/**
+	 * Reads or writes the value without a string round-trip, when the data source supports the type.
+	 * Return false when the caller should fall back to GetValueAsString/SetValueFromString.
+	 */
+	UE_API bool TryGetTypedValue(bool& OutValue) const;
+	UE_API bool TryGetTypedValue(int64& OutValue) const;
+	UE_API bool TryGetTypedValue(double& OutValue) const;
+	UE_API bool TryGetTypedValue(FLinearColor& OutValue) const;
+	UE_API bool TryGetTypedValue(FVector2D& OutValue) const;
+
+	UE_API bool TrySetTypedValue(bool InValue);
+	UE_API bool TrySetTypedValue(int64 InValue);
+	UE_API bool TrySetTypedValue(double InValue);
+	UE_API bool TrySetTypedValue(const FLinearColor& InValue);
+	UE_API bool TrySetTypedValue(const FVector2D& InValue);
+
+	/**
+	 * Finds the option matching the current value, read through TryGetTypedValue.  Returns false when the data source
+	 * doesn't support the subclass's type, GetDiscreteOptionIndex then compares the value as a string instead.
+	 */
+	virtual bool TryGetTypedOptionIndex(int32& OutIndex) const { return false; }
+
+	/** Finds the first option matching the predicate, parsing every option once until the options change. */
+	template<typename ValueType, typename ParseFuncType, typename PredicateType>
+	int32 FindParsedOptionIndex(TArray<ValueType>& InOutParsedOptions, ParseFuncType&& Parse, PredicateType&& Predicate) const
+	{
+		const uint32 OptionsVersion = GetDiscreteOptionsVersion();
+		if (InOutParsedOptions.Num() != OptionValues.Num() || ParsedOptionsVersion != OptionsVersion)
+		{
+			InOutParsedOptions.Reset(OptionValues.Num());
+			for (const FString& OptionValue : OptionValues)
+			{
+				InOutParsedOptions.Add(Parse(OptionValue));
+			}
+			ParsedOptionsVersion = OptionsVersion;
+		}
+
+		return InOutParsedOptions.IndexOfByPredicate(Forward<PredicateType>(Predicate));
+	}
+
+private:
+	template<typename ValueType>
+	bool TryGetTypedValueImpl(ValueType& OutValue) const;
+
+	template<typename ValueType>
+	bool TrySetTypedValueImpl(const ValueType& InValue);
+
+	UE_API void RebuildOptionValueIndices() const;
+
 protected:
 	TSharedPtr<FGameSettingDataSource> Getter;
 	TSharedPtr<FGameSettingDataSource> Setter;
@@ -69,6 +137,13 @@ protected:
 
 	TArray<FString> OptionValues;
 	TArray<FText> OptionDisplayTexts;
+
+private:
+	/** Option value to index in OptionValues, kept alongside it so lookups don't scan every option. */
+	mutable TMap<FString, int32> OptionValueIndices;
+
+	/** The options version the subclass's parsed options were built for, see FindParsedOptionIndex. */
+	mutable TOptional<uint32> ParsedOptionsVersion;
 };
 
 //////////////////////////////////////////////////////////////////////////
@@ -86,6 +161,9 @@ public:
 public:
 	UE_API void SetDefaultValue(bool Value);
 
+	UE_API bool GetValue() const;
+	UE_API void SetValue(bool InValue);
+
 	UE_API void SetTrueText(const FText& InText);
 	UE_API void SetFalseText(const FText& InText);
 
@@ -93,6 +171,13 @@ public:
 	void SetTrueText(const FString& Value) { SetTrueText(FText::FromString(Value)); }
 	void SetFalseText(const FString& Value) { SetFalseText(FText::FromString(Value)); }
 #endif
+
+protected:
+	/** UGameSettingValueDiscreteDynamic */
+	UE_API virtual bool TryGetTypedOptionIndex(int32& OutIndex) const override;
+
+private:
+	mutable TArray<bool> ParsedOptionValues;
 };
 
 //////////////////////////////////////////////////////////////////////////
@@ -123,6 +208,23 @@ public:
 	template<typename NumberType>
 	NumberType GetValue() const
 	{
+		if constexpr (std::is_floating_point_v<NumberType>)
+		{
+			double TypedValue;
+			if (TryGetTypedValue(TypedValue))
+			{
+				return (NumberType)TypedValue;
+			}
+		}
+		else if constexpr (std::is_integral_v<NumberType>)
+		{
+			int64 TypedValue;
+			if (TryGetTypedValue(TypedValue))
+			{
+				return (NumberType)TypedValue;
+			}
+		}
+
 		const FString ValueString = GetValueAsString();
 
 		NumberType OutValue;
@@ -134,12 +236,34 @@ public:
 	template<typename NumberType>
 	void SetValue(NumberType InValue)
 	{
+		if constexpr (std::is_floating_point_v<NumberType>)
+		{
+			if (TrySetTypedValue((double)InValue))
+			{
+				return;
+			}
+		}
+		else if constexpr (std::is_integral_v<NumberType>)
+		{
+			if (TrySetTypedValue((int64)InValue))
+			{
+				return;
+			}
+		}
+
 		SetValueFromString(LexToString(InValue));
 	}
 
 protected:
 	/** UGameSettingValue */
 	UE_API virtual void OnInitialized() override;
+
+	/** UGameSettingValueDiscreteDynamic */
+	UE_API virtual bool TryGetTypedOptionIndex(int32& OutIndex) const override;
+
+private:
+	/** Integer and floating point options are both parsed as doubles. */
+	mutable TArray<double> ParsedOptionValues;
 };
 
 //////////////////////////////////////////////////////////////////////////
@@ -158,20 +282,28 @@ public:
 	template<typename EnumType>
 	void SetDefaultValue(EnumType InEnumValue)
 	{
-		const FString StringValue = StaticEnum<EnumType>()->GetNameStringByValue((int64)InEnumValue);
+		OptionsEnum = StaticEnum<EnumType>();
+		const FString StringValue = OptionsEnum->GetNameStringByValue((int64)InEnumValue);
 		SetDefaultValueFromString(StringValue);
 	}
 
 	template<typename EnumType>
 	void AddEnumOption(EnumType InEnumValue, const FText& InOptionText)
 	{
-		const FString StringValue = StaticEnum<EnumType>()->GetNameStringByValue((int64)InEnumValue);
+		OptionsEnum = StaticEnum<EnumType>();
+		const FString StringValue = OptionsEnum->GetNameStringByValue((int64)InEnumValue);
 		AddDynamicOption(StringValue, InOptionText);
 	}
 
 	template<typename EnumType>
 	EnumType GetValue() const
 	{
+		int64 TypedValue;
+		if (TryGetTypedValue(TypedValue))
+		{
+			return (EnumType)TypedValue;
+		}
+
 		const FString Value = GetValueAsString();
 		return (EnumType)StaticEnum<EnumType>()->GetValueByNameString(Value);
 	}
@@ -179,6 +311,11 @@ public:
 	template<typename EnumType>
 	void SetValue(EnumType InEnumValue)
 	{
+		if (TrySetTypedValue((int64)InEnumValue))
+		{
+			return;
+		}
+
 		const FString StringValue = StaticEnum<EnumType>()->GetNameStringByValue((int64)InEnumValue);
 		SetValueFromString(StringValue);
 	}
@@ -186,6 +323,16 @@ public:
 protected:
 	/** UGameSettingValue */
 	UE_API virtual void OnInitialized() override;
+
+	/** UGameSettingValueDiscreteDynamic */
+	UE_API virtual bool TryGetTypedOptionIndex(int32& OutIndex) const override;
+
+private:
+	/** The enum the options were added from, to turn their names back into values. */
+	UPROPERTY(Transient)
+	TObjectPtr<const UEnum> OptionsEnum;
+
+	mutable TArray<int64> ParsedOptionValues;
 };
 
 //////////////////////////////////////////////////////////////////////////
@@ -214,6 +361,12 @@ public:
 
 	FLinearColor GetValue() const
 	{
+		FLinearColor TypedValue;
+		if (TryGetTypedValue(TypedValue))
+		{
+			return TypedValue;
+		}
+
 		const FString Value = GetValueAsString();
 		
 		FLinearColor ColorValue;
@@ -225,8 +378,20 @@ public:
 
 	void SetValue(FLinearColor InColor)
 	{
+		if (TrySetTypedValue(InColor))
+		{
+			return;
+		}
+
 		SetValueFromString(InColor.ToString());
 	}
+
+protected:
+	/** UGameSettingValueDiscreteDynamic */
+	UE_API virtual bool TryGetTypedOptionIndex(int32& OutIndex) const override;
+
+private:
+	mutable TArray<FLinearColor> ParsedOptionValues;
 };
 
 //////////////////////////////////////////////////////////////////////////
@@ -250,14 +415,31 @@ public:
 	FVector2D GetValue() const
 	{
 		FVector2D ValueVector;
+		if (TryGetTypedValue(ValueVector))
+		{
+			return ValueVector;
+		}
+
 		ValueVector.InitFromString(GetValueAsString());
 		return ValueVector;
 	}
 
 	void SetValue(const FVector2D& InValue)
 	{
+		if (TrySetTypedValue(InValue))
+		{
+			return;
+		}
+
 		SetValueFromString(InValue.ToString());
 	}
+
+protected:
+	/** UGameSettingValueDiscreteDynamic */
+	UE_API virtual bool TryGetTypedOptionIndex(int32& OutIndex) const override;
+
+private:
+	mutable TArray<FVector2D> ParsedOptionValues;
 };
 
 #undef UE_API
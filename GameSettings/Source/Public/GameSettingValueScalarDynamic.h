@@ -39,6 +39,9 @@ private:
 public:
 	UE_API UGameSettingValueScalarDynamic();
 
+	/** UGameSetting */
+	UE_API virtual void CopyDefinitionFrom(const UGameSetting& InFreshSetting) override;
+
 	/** UGameSettingValue */
 	UE_API virtual void Startup() override;
 	UE_API virtual void StoreInitial() override;
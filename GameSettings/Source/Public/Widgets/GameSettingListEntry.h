@@ -118,6 +118,9 @@ protected:
 	UPROPERTY()
 	TObjectPtr<UGameSettingValueDiscrete> DiscreteSetting;
 
+	/** The options version the rotator was last populated from, so it's only repopulated when the options change. */
+	TOptional<uint32> PopulatedOptionsVersion;
+
 private:	// Bound Widgets
 	UPROPERTY(BlueprintReadOnly, meta = (BindWidget, BlueprintProtected = true, AllowPrivateAccess = true))
 	TObjectPtr<UPanelWidget> Panel_Value;
@@ -76,6 +76,7 @@ protected:
 	UE_API void HandleSettingNamedAction(UGameSetting* Setting, FGameplayTag GameSettings_Action_Tag);
 	UE_API void HandleSettingNavigation(UGameSetting* Setting);
 	UE_API void HandleSettingEditConditionsChanged(UGameSetting* Setting);
+	UE_API void HandleRegistryFinishedInitializing();
 
 private:
 
@@ -98,6 +99,9 @@ private:
 
 	bool bAdjustListViewPostRefresh = true;
 
+	/** Set when a refresh was requested before the registry finished initializing. */
+	bool bRefreshWhenRegistryReady = false;
+
 private:	// Bound Widgets
 	UPROPERTY(BlueprintReadOnly, meta = (BindWidget, BlueprintProtected = true, AllowPrivateAccess = true))
 	TObjectPtr<UGameSettingListView> ListView_Settings;
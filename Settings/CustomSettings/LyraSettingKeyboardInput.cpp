@@ -88,6 +88,25 @@ UEnhancedInputUserSettings* ULyraSettingKeyboardInput::GetUserSettings() const
 	return nullptr;
 }
 
+bool ULyraSettingKeyboardInput::CanBeReusedFor(const UGameSetting& InReplacement) const
+{
+	// The DevName only comes from the mapping name, so the same row from another key profile must be rebuilt.
+	const ULyraSettingKeyboardInput* Replacement = Cast<ULyraSettingKeyboardInput>(&InReplacement);
+	return Replacement && Super::CanBeReusedFor(InReplacement) && Replacement->ProfileIdentifier == ProfileIdentifier;
+}
+
+void ULyraSettingKeyboardInput::CopyDefinitionFrom(const UGameSetting& InFreshSetting)
+{
+	// Our dynamic details are bound to this setting in OnInitialized, don't take the fresh setting's binding.
+	const FGetGameSettingsDetails OwnDynamicDetails = DynamicDetails;
+	Super::CopyDefinitionFrom(InFreshSetting);
+	DynamicDetails = OwnDynamicDetails;
+
+	const ULyraSettingKeyboardInput& FreshSetting = CastChecked<ULyraSettingKeyboardInput>(InFreshSetting);
+	ActionMappingName = FreshSetting.ActionMappingName;
+	QueryOptions = FreshSetting.QueryOptions;
+}
+
 void ULyraSettingKeyboardInput::OnInitialized()
 {
 	DynamicDetails = FGetGameSettingsDetails::CreateLambda([this](ULocalPlayer&)
@@ -29,6 +29,8 @@ public:
 	virtual void StoreInitial() override;
 	virtual void ResetToDefault() override;
 	virtual void RestoreToInitial() override;
+	virtual bool CanBeReusedFor(const UGameSetting& InReplacement) const override;
+	virtual void CopyDefinitionFrom(const UGameSetting& InFreshSetting) override;
 
 	bool ChangeBinding(int32 InKeyBindSlot, FKey NewKey);
 	void GetAllMappedActionsFromKey(int32 InKeyBindSlot, FKey Key, TArray<FName>& OutActionNames) const;
@@ -0,0 +1,52 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "LyraSettingStartupProviders.h"
+
+#include "Framework/Application/SlateApplication.h"
+#include "Internationalization/TextLocalizationManager.h"
+
+//--------------------------------------
+// FLyraScreenResolutionsProvider
+//--------------------------------------
+
+TSharedRef<FLyraScreenResolutionsProvider> FLyraScreenResolutionsProvider::Get()
+{
+	static TSharedRef<FLyraScreenResolutionsProvider> Provider = MakeShared<FLyraScreenResolutionsProvider>();
+	return Provider;
+}
+
+void FLyraScreenResolutionsProvider::Fetch(ULocalPlayer* InLocalPlayer, FSimpleDelegate FetchCompleteCallback)
+{
+	FSlateApplication::Get().GetInitialDisplayMetrics(InitialDisplayMetrics);
+
+	AvailableResolutions.Reset();
+	RHIGetAvailableResolutions(AvailableResolutions, true);
+
+	FetchCompleteCallback.ExecuteIfBound();
+}
+
+//--------------------------------------
+// FLyraCultureNamesProvider
+//--------------------------------------
+
+TSharedRef<FLyraCultureNamesProvider> FLyraCultureNamesProvider::Get()
+{
+	static TSharedRef<FLyraCultureNamesProvider> Provider = MakeShared<FLyraCultureNamesProvider>();
+	return Provider;
+}
+
+void FLyraCultureNamesProvider::Fetch(ULocalPlayer* InLocalPlayer, FSimpleDelegate FetchCompleteCallback)
+{
+	AllowedCultureNames.Reset();
+
+	const TArray<FString> AllCultureNames = FTextLocalizationManager::Get().GetLocalizedCultureNames(ELocalizationLoadFlags::Game);
+	for (const FString& CultureName : AllCultureNames)
+	{
+		if (FInternationalization::Get().IsCultureAllowed(CultureName))
+		{
+			AllowedCultureNames.Add(CultureName);
+		}
+	}
+
+	FetchCompleteCallback.ExecuteIfBound();
+}
@@ -0,0 +1,49 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "GameSettingStartupScheduler.h"
+#include "GenericPlatform/GenericApplication.h"
+#include "RHI.h"
+
+//--------------------------------------
+// FLyraScreenResolutionsProvider
+//--------------------------------------
+
+/** The display metrics and the resolutions the RHI supports, shared by every setting that lists resolutions. */
+class FLyraScreenResolutionsProvider : public FGameSettingStartupProvider
+{
+public:
+	static TSharedRef<FLyraScreenResolutionsProvider> Get();
+
+	/** FGameSettingStartupProvider */
+	virtual FName GetProviderName() const override { return TEXT("ScreenResolutions"); }
+	virtual void Fetch(ULocalPlayer* InLocalPlayer, FSimpleDelegate FetchCompleteCallback) override;
+
+	const FDisplayMetrics& GetInitialDisplayMetrics() const { return InitialDisplayMetrics; }
+	const FScreenResolutionArray& GetAvailableResolutions() const { return AvailableResolutions; }
+
+private:
+	FDisplayMetrics InitialDisplayMetrics;
+	FScreenResolutionArray AvailableResolutions;
+};
+
+//--------------------------------------
+// FLyraCultureNamesProvider
+//--------------------------------------
+
+/** The game's localized cultures that are allowed on this platform. */
+class FLyraCultureNamesProvider : public FGameSettingStartupProvider
+{
+public:
+	static TSharedRef<FLyraCultureNamesProvider> Get();
+
+	/** FGameSettingStartupProvider */
+	virtual FName GetProviderName() const override { return TEXT("CultureNames"); }
+	virtual void Fetch(ULocalPlayer* InLocalPlayer, FSimpleDelegate FetchCompleteCallback) override;
+
+	const TArray<FString>& GetAllowedCultureNames() const { return AllowedCultureNames; }
+
+private:
+	TArray<FString> AllowedCultureNames;
+};
@@ -32,8 +32,7 @@ void ULyraSettingValueDiscreteDynamic_AudioOutputDevice::OnAudioOutputDevicesObt
 	OutputDevices.Reset(NewSize++);
 	OutputDevices.Append(AvailableDevices);
 
-	OptionValues.Reset(NewSize);
-	OptionDisplayTexts.Reset(NewSize);
+	ResetDynamicOptions(NewSize);
 
 	// Placeholder - needs to be first option so we can format the default device string later
 	AddDynamicOption(TEXT(""), FText::GetEmpty());
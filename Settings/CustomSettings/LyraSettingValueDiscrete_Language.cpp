@@ -4,6 +4,7 @@
 
 #include "Internationalization/Culture.h"
 #include "Internationalization/TextLocalizationManager.h"
+#include "LyraSettingStartupProviders.h"
 #include "Messaging/CommonGameDialog.h"
 #include "Messaging/CommonMessagingSubsystem.h"
 #include "Player/LyraLocalPlayer.h"
@@ -17,22 +18,16 @@ static const int32 SettingSystemDefaultLanguageIndex = 0;
 
 ULyraSettingValueDiscrete_Language::ULyraSettingValueDiscrete_Language()
 {
+	AddStartupProvider(FLyraCultureNamesProvider::Get());
 }
 
 void ULyraSettingValueDiscrete_Language::OnInitialized()
 {
 	Super::OnInitialized();
 
-	const TArray<FString> AllCultureNames = FTextLocalizationManager::Get().GetLocalizedCultureNames(ELocalizationLoadFlags::Game);
-	for (const FString& CultureName : AllCultureNames)
-	{
-		if (FInternationalization::Get().IsCultureAllowed(CultureName))
-		{
-			AvailableCultureNames.Add(CultureName);
-		}
-	}
-
+	AvailableCultureNames = FLyraCultureNamesProvider::Get()->GetAllowedCultureNames();
 	AvailableCultureNames.Insert(TEXT(""), SettingSystemDefaultLanguageIndex);
+	MarkDiscreteOptionsChanged();
 }
 
 void ULyraSettingValueDiscrete_Language::StoreInitial()
@@ -29,6 +29,7 @@ public:
 	UE_API virtual void SetDiscreteOptionByIndex(int32 Index) override;
 	UE_API virtual int32 GetDiscreteOptionIndex() const override;
 	UE_API virtual TArray<FText> GetDiscreteOptions() const override;
+	virtual bool AreDiscreteOptionsVersioned() const override { return true; }
 
 protected:
 	/** UGameSettingValue */
@@ -28,6 +28,10 @@ void ULyraSettingValueDiscrete_MobileFPSType::OnInitialized()
 		}
 	}
 
+	FPSOptions.GenerateKeyArray(FPSOptionModes);
+	FPSOptions.GenerateValueArray(FPSOptionTexts);
+	MarkDiscreteOptionsChanged();
+
 	const int32 FirstFrameRateWithQualityLimit = UserSettings->GetFirstFrameRateWithQualityLimit();
 	if (FirstFrameRateWithQualityLimit > 0)
 	{
@@ -62,27 +66,19 @@ void ULyraSettingValueDiscrete_MobileFPSType::RestoreToInitial()
 
 void ULyraSettingValueDiscrete_MobileFPSType::SetDiscreteOptionByIndex(int32 Index)
 {
-	TArray<int32> FPSOptionsModes;
-	FPSOptions.GenerateKeyArray(FPSOptionsModes);
-
-	int32 NewMode = FPSOptionsModes.IsValidIndex(Index) ? FPSOptionsModes[Index] : GetDefaultFPS();
+	int32 NewMode = FPSOptionModes.IsValidIndex(Index) ? FPSOptionModes[Index] : GetDefaultFPS();
 
 	SetValue(NewMode, EGameSettingChangeReason::Change);
 }
 
 int32 ULyraSettingValueDiscrete_MobileFPSType::GetDiscreteOptionIndex() const
 {
-	TArray<int32> FPSOptionsModes;
-	FPSOptions.GenerateKeyArray(FPSOptionsModes);
-	return FPSOptionsModes.IndexOfByKey(GetValue());
+	return FPSOptionModes.IndexOfByKey(GetValue());
 }
 
 TArray<FText> ULyraSettingValueDiscrete_MobileFPSType::GetDiscreteOptions() const
 {
-	TArray<FText> Options;
-	FPSOptions.GenerateValueArray(Options);
-
-	return Options;
+	return FPSOptionTexts;
 }
 
 int32 ULyraSettingValueDiscrete_MobileFPSType::GetValue() const
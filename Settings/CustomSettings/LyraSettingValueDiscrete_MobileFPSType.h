@@ -30,6 +30,8 @@ public:
 	virtual void SetDiscreteOptionByIndex(int32 Index) override;
 	virtual int32 GetDiscreteOptionIndex() const override;
 	virtual TArray<FText> GetDiscreteOptions() const override;
+	virtual TConstArrayView<FText> GetDiscreteOptionsView() const override { return FPSOptionTexts; }
+	virtual bool AreDiscreteOptionsVersioned() const override { return true; }
 	//~End of UGameSettingValueDiscrete interface
 
 protected:
@@ -46,4 +48,8 @@ protected:
 protected:
 	int32 InitialValue;
 	TSortedMap<int32, FText> FPSOptions;
+
+	/** FPSOptions split into keys and values, so they aren't regenerated every time they're needed. */
+	TArray<int32> FPSOptionModes;
+	TArray<FText> FPSOptionTexts;
 };
@@ -30,6 +30,9 @@ void ULyraSettingValueDiscrete_OverallQuality::OnInitialized()
 	OptionsWithCustom = Options;
 	OptionsWithCustom.Add(LOCTEXT("VideoQualityOverall_Custom", "Custom"));
 
+	bOptionsIncludeCustom = (GetOverallQualityLevel() == INDEX_NONE);
+	MarkDiscreteOptionsChanged();
+
 	const int32 LowestQualityWithFrameRateLimit = UserSettings->GetLowestQualityWithFrameRateLimit();
 	if (Options.IsValidIndex(LowestQualityWithFrameRateLimit))
 	{
@@ -39,6 +42,24 @@ void ULyraSettingValueDiscrete_OverallQuality::OnInitialized()
 
 void ULyraSettingValueDiscrete_OverallQuality::StoreInitial()
 {
+	UpdateOptionsIncludeCustom();
+}
+
+void ULyraSettingValueDiscrete_OverallQuality::OnSettingChanged(EGameSettingChangeReason Reason)
+{
+	UpdateOptionsIncludeCustom();
+
+	Super::OnSettingChanged(Reason);
+}
+
+void ULyraSettingValueDiscrete_OverallQuality::UpdateOptionsIncludeCustom()
+{
+	const bool bIncludeCustom = (GetOverallQualityLevel() == INDEX_NONE);
+	if (bOptionsIncludeCustom != bIncludeCustom)
+	{
+		bOptionsIncludeCustom = bIncludeCustom;
+		MarkDiscreteOptionsChanged();
+	}
 }
 
 void ULyraSettingValueDiscrete_OverallQuality::ResetToDefault()
@@ -90,6 +111,11 @@ TArray<FText> ULyraSettingValueDiscrete_OverallQuality::GetDiscreteOptions() con
 	}
 }
 
+TConstArrayView<FText> ULyraSettingValueDiscrete_OverallQuality::GetDiscreteOptionsView() const
+{
+	return bOptionsIncludeCustom ? OptionsWithCustom : Options;
+}
+
 int32 ULyraSettingValueDiscrete_OverallQuality::GetCustomOptionIndex() const
 {
 	return OptionsWithCustom.Num() - 1;
@@ -26,15 +26,26 @@ public:
 	virtual void SetDiscreteOptionByIndex(int32 Index) override;
 	virtual int32 GetDiscreteOptionIndex() const override;
 	virtual TArray<FText> GetDiscreteOptions() const override;
+	virtual TConstArrayView<FText> GetDiscreteOptionsView() const override;
+	virtual bool AreDiscreteOptionsVersioned() const override { return true; }
 
 protected:
 	/** UGameSettingValue */
 	virtual void OnInitialized() override;
-	
+
+	/** UGameSetting */
+	virtual void OnSettingChanged(EGameSettingChangeReason Reason) override;
+
+	/** The custom option comes and goes with the quality level, which changes the options. */
+	void UpdateOptionsIncludeCustom();
+
 	int32 GetCustomOptionIndex() const;
 	int32 GetOverallQualityLevel() const;
 
 	TArray<FText> Options;
 	TArray<FText> OptionsWithCustom;
 
+	/** Whether the options were last reported with the custom option, see UpdateOptionsIncludeCustom. */
+	bool bOptionsIncludeCustom = false;
+
 };
@@ -75,6 +75,7 @@ void ULyraSettingValueDiscrete_PerfStat::AddMode(FText&& Label, ELyraStatDisplay
 {
 	Options.Emplace(MoveTemp(Label));
 	DisplayModes.Add(Mode);
+	MarkDiscreteOptionsChanged();
 }
 
 void ULyraSettingValueDiscrete_PerfStat::OnInitialized()
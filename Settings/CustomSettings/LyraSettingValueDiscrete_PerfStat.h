@@ -31,6 +31,8 @@ public:
 	virtual void SetDiscreteOptionByIndex(int32 Index) override;
 	virtual int32 GetDiscreteOptionIndex() const override;
 	virtual TArray<FText> GetDiscreteOptions() const override;
+	virtual TConstArrayView<FText> GetDiscreteOptionsView() const override { return Options; }
+	virtual bool AreDiscreteOptionsVersioned() const override { return true; }
 
 protected:
 	/** UGameSettingValue */
@@ -4,6 +4,7 @@
 
 #include "Framework/Application/SlateApplication.h"
 #include "GameFramework/GameUserSettings.h"
+#include "LyraSettingStartupProviders.h"
 #include "RHI.h"
 #include "UnrealEngine.h"
 
@@ -13,6 +14,7 @@
 
 ULyraSettingValueDiscrete_Resolution::ULyraSettingValueDiscrete_Resolution()
 {
+	AddStartupProvider(FLyraScreenResolutionsProvider::Get());
 }
 
 void ULyraSettingValueDiscrete_Resolution::OnInitialized()
@@ -78,12 +80,11 @@ void ULyraSettingValueDiscrete_Resolution::InitializeResolutions()
 	ResolutionsFullscreen.Empty();
 	ResolutionsWindowed.Empty();
 	ResolutionsWindowedFullscreen.Empty();
+	MarkDiscreteOptionsChanged();
 
-	FDisplayMetrics InitialDisplayMetrics;
-	FSlateApplication::Get().GetInitialDisplayMetrics(InitialDisplayMetrics);
-
-	FScreenResolutionArray ResArray;
-	RHIGetAvailableResolutions(ResArray, true);
+	const TSharedRef<FLyraScreenResolutionsProvider> ResolutionsProvider = FLyraScreenResolutionsProvider::Get();
+	const FDisplayMetrics& InitialDisplayMetrics = ResolutionsProvider->GetInitialDisplayMetrics();
+	const FScreenResolutionArray& ResArray = ResolutionsProvider->GetAvailableResolutions();
 
 	// Determine available windowed modes
 	{
@@ -126,7 +127,7 @@ void ULyraSettingValueDiscrete_Resolution::InitializeResolutions()
 
 	// Determine available windowed full-screen modes
 	{
-		FScreenResolutionRHI* RHIInitialResolution = ResArray.FindByPredicate([InitialDisplayMetrics](const FScreenResolutionRHI& ScreenRes) {
+		const FScreenResolutionRHI* RHIInitialResolution = ResArray.FindByPredicate([&InitialDisplayMetrics](const FScreenResolutionRHI& ScreenRes) {
 			return ScreenRes.Width == InitialDisplayMetrics.PrimaryDisplayWidth && ScreenRes.Height == InitialDisplayMetrics.PrimaryDisplayHeight;
 		});
 
@@ -190,6 +191,7 @@ void ULyraSettingValueDiscrete_Resolution::SelectAppropriateResolutions()
 	if (LastWindowMode != WindowMode)
 	{
 		LastWindowMode = WindowMode;
+		MarkDiscreteOptionsChanged();
 
 		Resolutions.Empty();
 		switch (WindowMode)
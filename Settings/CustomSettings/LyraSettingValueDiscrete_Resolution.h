@@ -29,6 +29,7 @@ public:
 	virtual void SetDiscreteOptionByIndex(int32 Index) override;
 	virtual int32 GetDiscreteOptionIndex() const override;
 	virtual TArray<FText> GetDiscreteOptions() const override;
+	virtual bool AreDiscreteOptionsVersioned() const override { return true; }
 
 protected:
 	/** UGameSettingValue */
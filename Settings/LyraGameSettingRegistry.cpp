@@ -3,6 +3,12 @@
 #include "LyraGameSettingRegistry.h"
 
 #include "GameSettingCollection.h"
+#include "GameSettingRegistryChangeTracker.h"
+#include "GameSettingRegistryDefinition.h"
+#include "GameSettingValueDiscrete.h"
+#include "GameSettingValueScalar.h"
+#include "HAL/IConsoleManager.h"
+#include "UObject/UObjectIterator.h"
 #include "LyraSettingsLocal.h"
 #include "LyraSettingsShared.h"
 #include "Player/LyraLocalPlayer.h"
@@ -13,6 +19,43 @@ DEFINE_LOG_CATEGORY(LogLyraGameSettingRegistry);
 
 #define LOCTEXT_NAMESPACE "Lyra"
 
+static TAutoConsoleVariable<bool> CVarBuildSettingsPagesOnDemand(TEXT("Lyra.Settings.BuildPagesOnDemand"),
+	false,
+	TEXT("If true, each top level settings page is only built the first time it's shown or looked up, rather than all of them when the registry is created.  Pair with GameSettings.UseRegistrySnapshot so looking up a setting only builds the page it's on."),
+	ECVF_Default);
+
+#if !UE_BUILD_SHIPPING
+static const TCHAR* LexToString(ELyraSettingApplyPath ApplyPath)
+{
+	switch (ApplyPath)
+	{
+	case ELyraSettingApplyPath::LocalApplySettings:					return TEXT("Local.ApplySettings");
+	case ELyraSettingApplyPath::LocalApplyNonResolutionSettings:	return TEXT("Local.ApplyNonResolutionSettings");
+	case ELyraSettingApplyPath::LocalApplyScalabilitySettings:		return TEXT("Local.ApplyScalabilitySettings");
+	case ELyraSettingApplyPath::LocalSaveSettings:					return TEXT("Local.SaveSettings");
+	case ELyraSettingApplyPath::SharedApplySubtitleOptions:			return TEXT("Shared.ApplySubtitleOptions");
+	case ELyraSettingApplyPath::SharedApplyBackgroundAudioSettings:	return TEXT("Shared.ApplyBackgroundAudioSettings");
+	case ELyraSettingApplyPath::SharedApplyCultureSettings:			return TEXT("Shared.ApplyCultureSettings");
+	case ELyraSettingApplyPath::SharedApplyInputSettings:			return TEXT("Shared.ApplyInputSettings");
+	case ELyraSettingApplyPath::SharedSaveSettings:					return TEXT("Shared.SaveSettings");
+	}
+	return TEXT("Unknown");
+}
+#endif
+
+namespace LyraSettingApplyCategories
+{
+	const FName LocalSave(TEXT("LocalSave"));
+	const FName LocalApply(TEXT("LocalApply"));
+	const FName Resolution(TEXT("Resolution"));
+	const FName Scalability(TEXT("Scalability"));
+	const FName SharedSave(TEXT("SharedSave"));
+	const FName Subtitles(TEXT("Subtitles"));
+	const FName BackgroundAudio(TEXT("BackgroundAudio"));
+	const FName Culture(TEXT("Culture"));
+	const FName Input(TEXT("Input"));
+}
+
 //--------------------------------------
 // ULyraGameSettingRegistry
 //--------------------------------------
@@ -51,8 +94,72 @@ bool ULyraGameSettingRegistry::IsFinishedInitializing() const
 	return false;
 }
 
+void ULyraGameSettingRegistry::WaitForSharedSettings()
+{
+	ULyraLocalPlayer* LocalPlayer = Cast<ULyraLocalPlayer>(OwningLocalPlayer);
+	if (SharedSettingsReadyHandle.IsValid() || !LocalPlayer || LocalPlayer->GetSharedSettings() != nullptr)
+	{
+		return;
+	}
+
+	// There's no load event for the shared settings, but this only checks a pointer, and only while they're missing.
+	SharedSettingsReadyHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateWeakLambda(this, [this](float DeltaTime)
+	{
+		ULyraLocalPlayer* LocalPlayer = Cast<ULyraLocalPlayer>(OwningLocalPlayer);
+		if (LocalPlayer && LocalPlayer->GetSharedSettings() == nullptr)
+		{
+			return true;
+		}
+
+		SharedSettingsReadyHandle.Reset();
+		BroadcastIfFinishedInitializing();
+		return false;
+	}));
+}
+
 void ULyraGameSettingRegistry::OnInitialize(ULocalPlayer* InLocalPlayer)
 {
+	WaitForSharedSettings();
+
+	if (CVarBuildSettingsPagesOnDemand.GetValueOnGameThread())
+	{
+		// Pages inside the top level pages are declared, so navigating to one only builds the page it's on.
+		RegisterLazySetting(TEXT("VideoCollection"), LOCTEXT("VideoCollection_Name", "Video"), FBuildGameSetting::CreateWeakLambda(this, [this](ULocalPlayer* LocalPlayer) -> UGameSetting*
+		{
+			ULyraLocalPlayer* LyraLocalPlayer = Cast<ULyraLocalPlayer>(LocalPlayer);
+			VideoSettings = InitializeVideoSettings(LyraLocalPlayer);
+			InitializeVideoSettings_FrameRates(VideoSettings, LyraLocalPlayer);
+			return VideoSettings;
+		}), { FName(TEXT("PerfStatsPage")) });
+
+		RegisterLazySetting(TEXT("AudioCollection"), LOCTEXT("AudioCollection_Name", "Audio"), FBuildGameSetting::CreateWeakLambda(this, [this](ULocalPlayer* LocalPlayer) -> UGameSetting*
+		{
+			AudioSettings = InitializeAudioSettings(Cast<ULyraLocalPlayer>(LocalPlayer));
+			return AudioSettings;
+		}), { FName(TEXT("SubtitlePage")) });
+
+		RegisterLazySetting(TEXT("GameplayCollection"), LOCTEXT("GameplayCollection_Name", "Gameplay"), FBuildGameSetting::CreateWeakLambda(this, [this](ULocalPlayer* LocalPlayer) -> UGameSetting*
+		{
+			GameplaySettings = InitializeGameplaySettings(Cast<ULyraLocalPlayer>(LocalPlayer));
+			return GameplaySettings;
+		}));
+
+		RegisterLazySetting(TEXT("MouseAndKeyboardCollection"), LOCTEXT("MouseAndKeyboardCollection_Name", "Mouse & Keyboard"), FBuildGameSetting::CreateWeakLambda(this, [this](ULocalPlayer* LocalPlayer) -> UGameSetting*
+		{
+			MouseAndKeyboardSettings = InitializeMouseAndKeyboardSettings(Cast<ULyraLocalPlayer>(LocalPlayer));
+			return MouseAndKeyboardSettings;
+		}));
+
+		RegisterLazySetting(TEXT("GamepadCollection"), LOCTEXT("GamepadCollection_Name", "Gamepad"), FBuildGameSetting::CreateWeakLambda(this, [this](ULocalPlayer* LocalPlayer) -> UGameSetting*
+		{
+			GamepadSettings = InitializeGamepadSettings(Cast<ULyraLocalPlayer>(LocalPlayer));
+			return GamepadSettings;
+		}));
+
+		RegisterSettingDefinitions(true);
+		return;
+	}
+
 	ULyraLocalPlayer* LyraLocalPlayer = Cast<ULyraLocalPlayer>(InLocalPlayer);
 
 	VideoSettings = InitializeVideoSettings(LyraLocalPlayer);
@@ -70,21 +177,287 @@ void ULyraGameSettingRegistry::OnInitialize(ULocalPlayer* InLocalPlayer)
 
 	GamepadSettings = InitializeGamepadSettings(LyraLocalPlayer);
 	RegisterSetting(GamepadSettings);
+
+	RegisterSettingDefinitions(false);
+}
+
+void ULyraGameSettingRegistry::RegisterSettingDefinitions(bool bBuildOnDemand)
+{
+	for (const TSoftObjectPtr<UGameSettingRegistryDefinition>& SettingDefinition : SettingDefinitions)
+	{
+		if (const UGameSettingRegistryDefinition* Definition = SettingDefinition.LoadSynchronous())
+		{
+			RegisterDefinition(Definition, bBuildOnDemand);
+		}
+		else
+		{
+			UE_LOG(LogLyraGameSettingRegistry, Warning, TEXT("Couldn't load the setting definition %s."), *SettingDefinition.ToString());
+		}
+	}
+}
+
+void ULyraGameSettingRegistry::SaveChanges(const FGameSettingApplyCategories& DirtyCategories)
+{
+	Super::SaveChanges(DirtyCategories);
+
+	ULyraLocalPlayer* LocalPlayer = Cast<ULyraLocalPlayer>(OwningLocalPlayer);
+	if (LocalPlayer == nullptr)
+	{
+		return;
+	}
+
+	ULyraSettingsLocal* LocalSettings = LocalPlayer->GetLocalSettings();
+	ULyraSettingsShared* SharedSettings = LocalPlayer->GetSharedSettings();
+
+	for (const ELyraSettingApplyPath ApplyPath : GatherApplyPaths(DirtyCategories))
+	{
+		switch (ApplyPath)
+		{
+		case ELyraSettingApplyPath::LocalApplySettings:
+			// Game user settings need to be applied to handle things like resolution, this saves indirectly
+			LocalSettings->ApplySettings(false);
+			CountApplyCall(ELyraSettingApplyPath::LocalApplySettings);
+			break;
+		case ELyraSettingApplyPath::LocalApplyNonResolutionSettings:
+			LocalSettings->ApplyNonResolutionSettings();
+			CountApplyCall(ELyraSettingApplyPath::LocalApplyNonResolutionSettings);
+			break;
+		case ELyraSettingApplyPath::LocalApplyScalabilitySettings:
+			LocalSettings->ApplyScalabilitySettings();
+			CountApplyCall(ELyraSettingApplyPath::LocalApplyScalabilitySettings);
+			break;
+		case ELyraSettingApplyPath::LocalSaveSettings:
+			LocalSettings->SaveSettings();
+			CountApplyCall(ELyraSettingApplyPath::LocalSaveSettings);
+			break;
+		case ELyraSettingApplyPath::SharedApplySubtitleOptions:
+			SharedSettings->ApplySubtitleOptions();
+			CountApplyCall(ELyraSettingApplyPath::SharedApplySubtitleOptions);
+			break;
+		case ELyraSettingApplyPath::SharedApplyBackgroundAudioSettings:
+			SharedSettings->ApplyBackgroundAudioSettings();
+			CountApplyCall(ELyraSettingApplyPath::SharedApplyBackgroundAudioSettings);
+			break;
+		case ELyraSettingApplyPath::SharedApplyCultureSettings:
+			SharedSettings->ApplyCultureSettings();
+			CountApplyCall(ELyraSettingApplyPath::SharedApplyCultureSettings);
+			break;
+		case ELyraSettingApplyPath::SharedApplyInputSettings:
+			SharedSettings->ApplyInputSettings();
+			CountApplyCall(ELyraSettingApplyPath::SharedApplyInputSettings);
+			break;
+		case ELyraSettingApplyPath::SharedSaveSettings:
+			SharedSettings->SaveSettings();
+			CountApplyCall(ELyraSettingApplyPath::SharedSaveSettings);
+			break;
+		}
+	}
+
+	UE_LOG(LogLyraGameSettingRegistry, Verbose, TEXT("Saved changes to the apply categories: %s"), *DirtyCategories.ToString());
+}
+
+ULyraGameSettingRegistry::FApplyPaths ULyraGameSettingRegistry::GatherApplyPaths(const FGameSettingApplyCategories& DirtyCategories)
+{
+	using namespace LyraSettingApplyCategories;
+
+	FApplyPaths ApplyPaths;
+
+	if (DirtyCategories.Contains(Resolution))
+	{
+		ApplyPaths.Add(ELyraSettingApplyPath::LocalApplySettings);
+	}
+	else
+	{
+		if (DirtyCategories.Contains(LocalApply))
+		{
+			ApplyPaths.Add(ELyraSettingApplyPath::LocalApplyNonResolutionSettings);
+		}
+		else if (DirtyCategories.Contains(Scalability))
+		{
+			// ApplyNonResolutionSettings already applies the scalability settings.
+			ApplyPaths.Add(ELyraSettingApplyPath::LocalApplyScalabilitySettings);
+		}
+
+		if (DirtyCategories.Contains(LocalApply) || DirtyCategories.Contains(Scalability) || DirtyCategories.Contains(LocalSave))
+		{
+			ApplyPaths.Add(ELyraSettingApplyPath::LocalSaveSettings);
+		}
+	}
+
+	bool bSaveSharedSettings = DirtyCategories.Contains(SharedSave);
+
+	if (DirtyCategories.Contains(Subtitles))
+	{
+		ApplyPaths.Add(ELyraSettingApplyPath::SharedApplySubtitleOptions);
+		bSaveSharedSettings = true;
+	}
+
+	if (DirtyCategories.Contains(BackgroundAudio))
+	{
+		ApplyPaths.Add(ELyraSettingApplyPath::SharedApplyBackgroundAudioSettings);
+		bSaveSharedSettings = true;
+	}
+
+	if (DirtyCategories.Contains(Culture))
+	{
+		ApplyPaths.Add(ELyraSettingApplyPath::SharedApplyCultureSettings);
+		bSaveSharedSettings = true;
+	}
+
+	if (DirtyCategories.Contains(Input))
+	{
+		ApplyPaths.Add(ELyraSettingApplyPath::SharedApplyInputSettings);
+		bSaveSharedSettings = true;
+	}
+
+	if (bSaveSharedSettings)
+	{
+		ApplyPaths.Add(ELyraSettingApplyPath::SharedSaveSettings);
+	}
+
+	return ApplyPaths;
 }
 
-void ULyraGameSettingRegistry::SaveChanges()
+void ULyraGameSettingRegistry::CountApplyCall(ELyraSettingApplyPath InApplyPath)
 {
-	Super::SaveChanges();
-	
-	if (ULyraLocalPlayer* LocalPlayer = Cast<ULyraLocalPlayer>(OwningLocalPlayer))
+#if !UE_BUILD_SHIPPING
+	ApplyCallCounts.FindOrAdd(LexToString(InApplyPath))++;
+#endif
+}
+
+#if !UE_BUILD_SHIPPING
+bool ULyraGameSettingRegistry::CountApplyCallsForChange(const FName& InDevName, FGameSettingApplyCategories& OutDirtyCategories, TMap<FName, int32>& OutApplyCallCounts, TArray<FString>& OutProblems)
+{
+	OutDirtyCategories = FGameSettingApplyCategories();
+	OutApplyCallCounts.Reset();
+	OutProblems.Reset();
+
+	UGameSetting* Setting = FindSettingByDevName(InDevName);
+	UGameSettingValueDiscrete* DiscreteSetting = Cast<UGameSettingValueDiscrete>(Setting);
+	UGameSettingValueScalar* ScalarSetting = Cast<UGameSettingValueScalar>(Setting);
+
+	// Pick a different value, and remember the current one to put back afterwards.
+	const int32 InitialOptionIndex = DiscreteSetting ? DiscreteSetting->GetDiscreteOptionIndex() : INDEX_NONE;
+	const int32 NumOptions = DiscreteSetting ? DiscreteSetting->GetDiscreteOptionsView().Num() : 0;
+	const double InitialNormalizedValue = ScalarSetting ? ScalarSetting->GetValueNormalized() : 0.0;
+	if (!(DiscreteSetting && NumOptions > 1) && !ScalarSetting)
+	{
+		return false;
+	}
+
+	FGameSettingRegistryChangeTracker ChangeTracker;
+	ChangeTracker.WatchRegistry(this);
+
+	auto SetValue = [&](bool bChanged)
+	{
+		if (DiscreteSetting)
+		{
+			DiscreteSetting->SetDiscreteOptionByIndex(bChanged ? (FMath::Max(InitialOptionIndex, 0) + 1) % NumOptions : InitialOptionIndex);
+		}
+		else
+		{
+			ScalarSetting->SetValueNormalized(bChanged ? (InitialNormalizedValue < 0.5 ? 1.0 : 0.0) : InitialNormalizedValue);
+		}
+	};
+
+	{
+		TGuardValue<TMap<FName, int32>> CountsGuard(ApplyCallCounts, TMap<FName, int32>());
+
+		SetValue(true);
+		OutDirtyCategories = ChangeTracker.ApplyChanges();
+		SaveChanges(OutDirtyCategories);
+
+		OutApplyCallCounts = ApplyCallCounts;
+	}
+
+	// Put the setting back the same way, without counting it.  A discrete value that isn't one of the options can't be.
+	if (ScalarSetting || InitialOptionIndex != INDEX_NONE)
+	{
+		SetValue(false);
+		SaveChanges(ChangeTracker.ApplyChanges());
+	}
+
+	ChangeTracker.StopWatchingRegistry();
+
+	const TConstArrayView<FName> ApplyCategories = Setting->FindEffectiveApplyCategories();
+	if (ApplyCategories.Num() == 0 && !OutDirtyCategories.IsAll())
+	{
+		OutProblems.Add(FString::Printf(TEXT("%s has no apply category, but only made %s dirty"), *InDevName.ToString(), *OutDirtyCategories.ToString()));
+	}
+
+	for (const FName& ApplyCategory : ApplyCategories)
 	{
-		// Game user settings need to be applied to handle things like resolution, this saves indirectly
-		LocalPlayer->GetLocalSettings()->ApplySettings(false);
-		
-		LocalPlayer->GetSharedSettings()->ApplySettings();
-		LocalPlayer->GetSharedSettings()->SaveSettings();
+		if (!OutDirtyCategories.Contains(ApplyCategory))
+		{
+			OutProblems.Add(FString::Printf(TEXT("%s didn't make its apply category %s dirty"), *InDevName.ToString(), *ApplyCategory.ToString()));
+		}
 	}
+
+	const FApplyPaths ExpectedApplyPaths = GatherApplyPaths(OutDirtyCategories);
+	for (const ELyraSettingApplyPath ApplyPath : ExpectedApplyPaths)
+	{
+		const int32 ApplyCallCount = OutApplyCallCounts.FindRef(LexToString(ApplyPath));
+		if (ApplyCallCount != 1)
+		{
+			OutProblems.Add(FString::Printf(TEXT("%s ran %d times, expected once"), LexToString(ApplyPath), ApplyCallCount));
+		}
+	}
+
+	for (const TPair<FName, int32>& ApplyCallCount : OutApplyCallCounts)
+	{
+		const bool bExpected = ExpectedApplyPaths.ContainsByPredicate([&ApplyCallCount](ELyraSettingApplyPath ApplyPath) { return ApplyCallCount.Key == LexToString(ApplyPath); });
+		if (!bExpected)
+		{
+			OutProblems.Add(FString::Printf(TEXT("%s ran, but none of %s need it"), *ApplyCallCount.Key.ToString(), *OutDirtyCategories.ToString()));
+		}
+	}
+
+	return true;
 }
 
+static FAutoConsoleCommand CmdCountApplyCalls(
+	TEXT("Lyra.Settings.CountApplyCalls"),
+	TEXT("Changes the setting in every Lyra settings registry, applies and saves it, and lists how often each apply path ran before putting the setting back.  Usage: Lyra.Settings.CountApplyCalls <DevName>"),
+	FConsoleCommandWithArgsDelegate::CreateStatic([](const TArray<FString>& Args)
+	{
+		if (Args.Num() == 0)
+		{
+			UE_LOG(LogConsoleResponse, Warning, TEXT("Usage: Lyra.Settings.CountApplyCalls <DevName>"));
+			return;
+		}
+
+		const FName DevName(*Args[0]);
+		for (TObjectIterator<ULyraGameSettingRegistry> It; It; ++It)
+		{
+			if (It->HasAnyFlags(RF_ClassDefaultObject))
+			{
+				continue;
+			}
+
+			FGameSettingApplyCategories DirtyCategories;
+			TMap<FName, int32> ApplyCallCounts;
+			TArray<FString> Problems;
+			if (!It->CountApplyCallsForChange(DevName, DirtyCategories, ApplyCallCounts, Problems))
+			{
+				UE_LOG(LogConsoleResponse, Warning, TEXT("%s: %s isn't a discrete or scalar setting with another value to change to."), *It->GetName(), *DevName.ToString());
+				continue;
+			}
+
+			ApplyCallCounts.KeySort(FNameLexicalLess());
+
+			UE_LOG(LogConsoleResponse, Display, TEXT("%s: changing %s made %s dirty and ran %d apply paths"), *It->GetName(), *DevName.ToString(), *DirtyCategories.ToString(), ApplyCallCounts.Num());
+			for (const TPair<FName, int32>& ApplyCallCount : ApplyCallCounts)
+			{
+				UE_LOG(LogConsoleResponse, Display, TEXT("  %s x%d"), *ApplyCallCount.Key.ToString(), ApplyCallCount.Value);
+			}
+
+			for (const FString& Problem : Problems)
+			{
+				UE_LOG(LogConsoleResponse, Warning, TEXT("  %s"), *Problem);
+			}
+		}
+	}));
+#endif
+
 #undef LOCTEXT_NAMESPACE
 
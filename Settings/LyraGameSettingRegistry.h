@@ -2,7 +2,9 @@
 
 #pragma once
 
+#include "Containers/Ticker.h"
 #include "DataSource/GameSettingDataSourceDynamic.h" // IWYU pragma: keep
+#include "DataSource/GameSettingDataSourceNative.h" // IWYU pragma: keep
 #include "GameSettingRegistry.h"
 #include "Settings/LyraSettingsLocal.h" // IWYU pragma: keep
 
@@ -16,10 +18,44 @@ class UObject;
 //--------------------------------------
 
 class UGameSettingCollection;
+class UGameSettingRegistryDefinition;
 class ULyraLocalPlayer;
 
 DECLARE_LOG_CATEGORY_EXTERN(LogLyraGameSettingRegistry, Log, Log);
 
+/** The apply categories of the Lyra settings, each selects an apply path in ULyraGameSettingRegistry::SaveChanges. */
+namespace LyraSettingApplyCategories
+{
+	/** Local settings that take effect when they're set, and only need saving. */
+	extern const FName LocalSave;
+	/** Local settings that take effect in ApplyNonResolutionSettings, e.g. vsync, headphone mode or the device profile. */
+	extern const FName LocalApply;
+	extern const FName Resolution;
+	extern const FName Scalability;
+
+	/** Shared settings that take effect when they're set, and only need saving. */
+	extern const FName SharedSave;
+	extern const FName Subtitles;
+	extern const FName BackgroundAudio;
+	extern const FName Culture;
+	/** The enhanced input user settings, e.g. key bindings. */
+	extern const FName Input;
+}
+
+/** What ULyraGameSettingRegistry::SaveChanges can run for the dirty apply categories. */
+enum class ELyraSettingApplyPath : uint8
+{
+	LocalApplySettings,
+	LocalApplyNonResolutionSettings,
+	LocalApplyScalabilitySettings,
+	LocalSaveSettings,
+	SharedApplySubtitleOptions,
+	SharedApplyBackgroundAudioSettings,
+	SharedApplyCultureSettings,
+	SharedApplyInputSettings,
+	SharedSaveSettings,
+};
+
 #define GET_SHARED_SETTINGS_FUNCTION_PATH(FunctionOrPropertyName)							\
 	MakeShared<FGameSettingDataSourceDynamic>(TArray<FString>({								\
 		GET_FUNCTION_NAME_STRING_CHECKED(ULyraLocalPlayer, GetSharedSettings),				\
@@ -32,10 +68,32 @@ DECLARE_LOG_CATEGORY_EXTERN(LogLyraGameSettingRegistry, Log, Log);
 		GET_FUNCTION_NAME_STRING_CHECKED(ULyraSettingsLocal, FunctionOrPropertyName)		\
 	}))
 
+// Native versions of the macros above, for getters and setters.  They bind the member function directly, so there's
+// no path to resolve at runtime.  Properties still have to go through the function path macros.
+#define GET_SHARED_SETTINGS_NATIVE(GetterOrSetterName)										\
+	MakeGameSettingDataSourceNative<ULyraSettingsShared>(									\
+		[](ULocalPlayer* InLocalPlayer) -> ULyraSettingsShared*								\
+		{																					\
+			const ULyraLocalPlayer* LyraLocalPlayer = Cast<ULyraLocalPlayer>(InLocalPlayer);\
+			return LyraLocalPlayer ? LyraLocalPlayer->GetSharedSettings() : nullptr;		\
+		},																					\
+		&ULyraSettingsShared::GetterOrSetterName,											\
+		TEXT("GetSharedSettings." #GetterOrSetterName))
+
+#define GET_LOCAL_SETTINGS_NATIVE(GetterOrSetterName)										\
+	MakeGameSettingDataSourceNative<ULyraSettingsLocal>(									\
+		[](ULocalPlayer* InLocalPlayer) -> ULyraSettingsLocal*								\
+		{																					\
+			const ULyraLocalPlayer* LyraLocalPlayer = Cast<ULyraLocalPlayer>(InLocalPlayer);\
+			return LyraLocalPlayer ? LyraLocalPlayer->GetLocalSettings() : nullptr;			\
+		},																					\
+		&ULyraSettingsLocal::GetterOrSetterName,											\
+		TEXT("GetLocalSettings." #GetterOrSetterName))
+
 /**
  * 
  */
-UCLASS()
+UCLASS(config=Game)
 class ULyraGameSettingRegistry : public UGameSettingRegistry
 {
 	GENERATED_BODY()
@@ -45,12 +103,27 @@ public:
 
 	static ULyraGameSettingRegistry* Get(ULyraLocalPlayer* InLocalPlayer);
 	
-	virtual void SaveChanges() override;
+	using Super::SaveChanges;
+
+	/** Only runs the apply paths of the dirty categories, see LyraSettingApplyCategories. */
+	virtual void SaveChanges(const FGameSettingApplyCategories& DirtyCategories) override;
+
+#if !UE_BUILD_SHIPPING
+	/**
+	 * Changes the setting, applies it through a change tracker and saves, counting how often SaveChanges ran each
+	 * apply path, then puts the setting back.  Anything that doesn't match the setting's apply categories is added to
+	 * OutProblems.  Returns false if the setting couldn't be changed, see Lyra.Settings.CountApplyCalls.
+	 */
+	bool CountApplyCallsForChange(const FName& InDevName, FGameSettingApplyCategories& OutDirtyCategories, TMap<FName, int32>& OutApplyCallCounts, TArray<FString>& OutProblems);
+#endif
 
 protected:
 	virtual void OnInitialize(ULocalPlayer* InLocalPlayer) override;
 	virtual bool IsFinishedInitializing() const override;
 
+	/** Bump whenever the settings the Initialize*Settings functions build change. */
+	virtual uint32 GetSnapshotDefinitionVersion() const override { return 1; }
+
 	UGameSettingCollection* InitializeVideoSettings(ULyraLocalPlayer* InLocalPlayer);
 	void InitializeVideoSettings_FrameRates(UGameSettingCollection* Screen, ULyraLocalPlayer* InLocalPlayer);
 	void AddPerformanceStatPage(UGameSettingCollection* Screen, ULyraLocalPlayer* InLocalPlayer);
@@ -61,6 +134,11 @@ protected:
 	UGameSettingCollection* InitializeMouseAndKeyboardSettings(ULyraLocalPlayer* InLocalPlayer);
 	UGameSettingCollection* InitializeGamepadSettings(ULyraLocalPlayer* InLocalPlayer);
 
+	/** Shared settings may still be loading when the registry is created, we aren't finished initializing until they arrive. */
+	void WaitForSharedSettings();
+
+	void RegisterSettingDefinitions(bool bBuildOnDemand);
+
 	UPROPERTY()
 	TObjectPtr<UGameSettingCollection> VideoSettings;
 
@@ -75,4 +153,23 @@ protected:
 
 	UPROPERTY()
 	TObjectPtr<UGameSettingCollection> GamepadSettings;
+
+	/** Settings described as data, registered after the ones built in code, see UGameSettingRegistryDefinition. */
+	UPROPERTY(Config)
+	TArray<TSoftObjectPtr<UGameSettingRegistryDefinition>> SettingDefinitions;
+
+private:
+	using FApplyPaths = TArray<ELyraSettingApplyPath, TInlineAllocator<8>>;
+
+	/** The apply paths SaveChanges runs for the dirty categories, in the order it runs them. */
+	static FApplyPaths GatherApplyPaths(const FGameSettingApplyCategories& DirtyCategories);
+
+	void CountApplyCall(ELyraSettingApplyPath InApplyPath);
+
+	FTSTicker::FDelegateHandle SharedSettingsReadyHandle;
+
+#if !UE_BUILD_SHIPPING
+	/** How often SaveChanges ran each apply path, see CountApplyCallsForChange. */
+	TMap<FName, int32> ApplyCallCounts;
+#endif
 };
@@ -24,6 +24,7 @@ UGameSettingCollection* ULyraGameSettingRegistry::InitializeAudioSettings(ULyraL
 {
 	UGameSettingCollection* Screen = NewObject<UGameSettingCollection>();
 	Screen->SetDevName(TEXT("AudioCollection"));
+	Screen->AddApplyCategory(LyraSettingApplyCategories::LocalSave);
 	Screen->SetDisplayName(LOCTEXT("AudioCollection_Name", "Audio"));
 	Screen->Initialize(InLocalPlayer);
 
@@ -42,8 +43,8 @@ UGameSettingCollection* ULyraGameSettingRegistry::InitializeAudioSettings(ULyraL
 			Setting->SetDisplayName(LOCTEXT("OverallVolume_Name", "Overall"));
 			Setting->SetDescriptionRichText(LOCTEXT("OverallVolume_Description", "Adjusts the volume of everything."));
 
-			Setting->SetDynamicGetter(GET_LOCAL_SETTINGS_FUNCTION_PATH(GetOverallVolume));
-			Setting->SetDynamicSetter(GET_LOCAL_SETTINGS_FUNCTION_PATH(SetOverallVolume));
+			Setting->SetDynamicGetter(GET_LOCAL_SETTINGS_NATIVE(GetOverallVolume));
+			Setting->SetDynamicSetter(GET_LOCAL_SETTINGS_NATIVE(SetOverallVolume));
 			Setting->SetDefaultValue(GetDefault<ULyraSettingsLocal>()->GetOverallVolume());
 			Setting->SetDisplayFormat(UGameSettingValueScalarDynamic::ZeroToOnePercent);
 
@@ -58,8 +59,8 @@ UGameSettingCollection* ULyraGameSettingRegistry::InitializeAudioSettings(ULyraL
 			Setting->SetDisplayName(LOCTEXT("MusicVolume_Name", "Music"));
 			Setting->SetDescriptionRichText(LOCTEXT("MusicVolume_Description", "Adjusts the volume of music."));
 
-			Setting->SetDynamicGetter(GET_LOCAL_SETTINGS_FUNCTION_PATH(GetMusicVolume));
-			Setting->SetDynamicSetter(GET_LOCAL_SETTINGS_FUNCTION_PATH(SetMusicVolume));
+			Setting->SetDynamicGetter(GET_LOCAL_SETTINGS_NATIVE(GetMusicVolume));
+			Setting->SetDynamicSetter(GET_LOCAL_SETTINGS_NATIVE(SetMusicVolume));
 			Setting->SetDefaultValue(GetDefault<ULyraSettingsLocal>()->GetMusicVolume());
 			Setting->SetDisplayFormat(UGameSettingValueScalarDynamic::ZeroToOnePercent);
 
@@ -74,8 +75,8 @@ UGameSettingCollection* ULyraGameSettingRegistry::InitializeAudioSettings(ULyraL
 			Setting->SetDisplayName(LOCTEXT("SoundEffectsVolume_Name", "Sound Effects"));
 			Setting->SetDescriptionRichText(LOCTEXT("SoundEffectsVolume_Description", "Adjusts the volume of sound effects."));
 
-			Setting->SetDynamicGetter(GET_LOCAL_SETTINGS_FUNCTION_PATH(GetSoundFXVolume));
-			Setting->SetDynamicSetter(GET_LOCAL_SETTINGS_FUNCTION_PATH(SetSoundFXVolume));
+			Setting->SetDynamicGetter(GET_LOCAL_SETTINGS_NATIVE(GetSoundFXVolume));
+			Setting->SetDynamicSetter(GET_LOCAL_SETTINGS_NATIVE(SetSoundFXVolume));
 			Setting->SetDefaultValue(GetDefault<ULyraSettingsLocal>()->GetSoundFXVolume());
 			Setting->SetDisplayFormat(UGameSettingValueScalarDynamic::ZeroToOnePercent);
 
@@ -90,8 +91,8 @@ UGameSettingCollection* ULyraGameSettingRegistry::InitializeAudioSettings(ULyraL
 			Setting->SetDisplayName(LOCTEXT("DialogueVolume_Name", "Dialogue"));
 			Setting->SetDescriptionRichText(LOCTEXT("DialogueVolume_Description", "Adjusts the volume of dialogue for game characters and voice overs."));
 
-			Setting->SetDynamicGetter(GET_LOCAL_SETTINGS_FUNCTION_PATH(GetDialogueVolume));
-			Setting->SetDynamicSetter(GET_LOCAL_SETTINGS_FUNCTION_PATH(SetDialogueVolume));
+			Setting->SetDynamicGetter(GET_LOCAL_SETTINGS_NATIVE(GetDialogueVolume));
+			Setting->SetDynamicSetter(GET_LOCAL_SETTINGS_NATIVE(SetDialogueVolume));
 			Setting->SetDefaultValue(GetDefault<ULyraSettingsLocal>()->GetDialogueVolume());
 			Setting->SetDisplayFormat(UGameSettingValueScalarDynamic::ZeroToOnePercent);
 
@@ -106,8 +107,8 @@ UGameSettingCollection* ULyraGameSettingRegistry::InitializeAudioSettings(ULyraL
 			Setting->SetDisplayName(LOCTEXT("VoiceChatVolume_Name", "Voice Chat"));
 			Setting->SetDescriptionRichText(LOCTEXT("VoiceChatVolume_Description", "Adjusts the volume of voice chat."));
 
-			Setting->SetDynamicGetter(GET_LOCAL_SETTINGS_FUNCTION_PATH(GetVoiceChatVolume));
-			Setting->SetDynamicSetter(GET_LOCAL_SETTINGS_FUNCTION_PATH(SetVoiceChatVolume));
+			Setting->SetDynamicGetter(GET_LOCAL_SETTINGS_NATIVE(GetVoiceChatVolume));
+			Setting->SetDynamicSetter(GET_LOCAL_SETTINGS_NATIVE(SetVoiceChatVolume));
 			Setting->SetDefaultValue(GetDefault<ULyraSettingsLocal>()->GetVoiceChatVolume());
 			Setting->SetDisplayFormat(UGameSettingValueScalarDynamic::ZeroToOnePercent);
 
@@ -130,6 +131,7 @@ UGameSettingCollection* ULyraGameSettingRegistry::InitializeAudioSettings(ULyraL
 		{
 			UGameSettingCollectionPage* SubtitlePage = NewObject<UGameSettingCollectionPage>();
 			SubtitlePage->SetDevName(TEXT("SubtitlePage"));
+			SubtitlePage->AddApplyCategory(LyraSettingApplyCategories::Subtitles);
 			SubtitlePage->SetDisplayName(LOCTEXT("SubtitlePage_Name", "Subtitles"));
 			SubtitlePage->SetDescriptionRichText(LOCTEXT("SubtitlePage_Description", "Configure the visual appearance of subtitles."));
 			SubtitlePage->SetNavigationText(LOCTEXT("SubtitlePage_Navigation", "Options"));
@@ -153,8 +155,8 @@ UGameSettingCollection* ULyraGameSettingRegistry::InitializeAudioSettings(ULyraL
 					Setting->SetDisplayName(LOCTEXT("Subtitles_Name", "Subtitles"));
 					Setting->SetDescriptionRichText(LOCTEXT("Subtitles_Description", "Turns subtitles on/off."));
 
-					Setting->SetDynamicGetter(GET_SHARED_SETTINGS_FUNCTION_PATH(GetSubtitlesEnabled));
-					Setting->SetDynamicSetter(GET_SHARED_SETTINGS_FUNCTION_PATH(SetSubtitlesEnabled));
+					Setting->SetDynamicGetter(GET_SHARED_SETTINGS_NATIVE(GetSubtitlesEnabled));
+					Setting->SetDynamicSetter(GET_SHARED_SETTINGS_NATIVE(SetSubtitlesEnabled));
 					Setting->SetDefaultValue(GetDefault<ULyraSettingsShared>()->GetSubtitlesEnabled());
 
 					SubtitleCollection->AddSetting(Setting);
@@ -166,8 +168,8 @@ UGameSettingCollection* ULyraGameSettingRegistry::InitializeAudioSettings(ULyraL
 					Setting->SetDisplayName(LOCTEXT("SubtitleTextSize_Name", "Text Size"));
 					Setting->SetDescriptionRichText(LOCTEXT("SubtitleTextSize_Description", "Choose different sizes of the the subtitle text."));
 
-					Setting->SetDynamicGetter(GET_SHARED_SETTINGS_FUNCTION_PATH(GetSubtitlesTextSize));
-					Setting->SetDynamicSetter(GET_SHARED_SETTINGS_FUNCTION_PATH(SetSubtitlesTextSize));
+					Setting->SetDynamicGetter(GET_SHARED_SETTINGS_NATIVE(GetSubtitlesTextSize));
+					Setting->SetDynamicSetter(GET_SHARED_SETTINGS_NATIVE(SetSubtitlesTextSize));
 					Setting->SetDefaultValue(GetDefault<ULyraSettingsShared>()->GetSubtitlesTextSize());
 					Setting->AddEnumOption(ESubtitleDisplayTextSize::ExtraSmall, LOCTEXT("ESubtitleTextSize_ExtraSmall", "Extra Small"));
 					Setting->AddEnumOption(ESubtitleDisplayTextSize::Small, LOCTEXT("ESubtitleTextSize_Small", "Small"));
@@ -184,8 +186,8 @@ UGameSettingCollection* ULyraGameSettingRegistry::InitializeAudioSettings(ULyraL
 					Setting->SetDisplayName(LOCTEXT("SubtitleTextColor_Name", "Text Color"));
 					Setting->SetDescriptionRichText(LOCTEXT("SubtitleTextColor_Description", "Choose different colors for the subtitle text."));
 
-					Setting->SetDynamicGetter(GET_SHARED_SETTINGS_FUNCTION_PATH(GetSubtitlesTextColor));
-					Setting->SetDynamicSetter(GET_SHARED_SETTINGS_FUNCTION_PATH(SetSubtitlesTextColor));
+					Setting->SetDynamicGetter(GET_SHARED_SETTINGS_NATIVE(GetSubtitlesTextColor));
+					Setting->SetDynamicSetter(GET_SHARED_SETTINGS_NATIVE(SetSubtitlesTextColor));
 					Setting->SetDefaultValue(GetDefault<ULyraSettingsShared>()->GetSubtitlesTextColor());
 					Setting->AddEnumOption(ESubtitleDisplayTextColor::White, LOCTEXT("ESubtitleTextColor_White", "White"));
 					Setting->AddEnumOption(ESubtitleDisplayTextColor::Yellow, LOCTEXT("ESubtitleTextColor_Yellow", "Yellow"));
@@ -199,8 +201,8 @@ UGameSettingCollection* ULyraGameSettingRegistry::InitializeAudioSettings(ULyraL
 					Setting->SetDisplayName(LOCTEXT("SubtitleBackgroundStyle_Name", "Text Border"));
 					Setting->SetDescriptionRichText(LOCTEXT("SubtitleTextBorder_Description", "Choose different borders for the text."));
 
-					Setting->SetDynamicGetter(GET_SHARED_SETTINGS_FUNCTION_PATH(GetSubtitlesTextBorder));
-					Setting->SetDynamicSetter(GET_SHARED_SETTINGS_FUNCTION_PATH(SetSubtitlesTextBorder));
+					Setting->SetDynamicGetter(GET_SHARED_SETTINGS_NATIVE(GetSubtitlesTextBorder));
+					Setting->SetDynamicSetter(GET_SHARED_SETTINGS_NATIVE(SetSubtitlesTextBorder));
 					Setting->SetDefaultValue(GetDefault<ULyraSettingsShared>()->GetSubtitlesTextBorder());
 					Setting->AddEnumOption(ESubtitleDisplayTextBorder::None, LOCTEXT("ESubtitleTextBorder_None", "None"));
 					Setting->AddEnumOption(ESubtitleDisplayTextBorder::Outline, LOCTEXT("ESubtitleTextBorder_Outline", "Outline"));
@@ -215,8 +217,8 @@ UGameSettingCollection* ULyraGameSettingRegistry::InitializeAudioSettings(ULyraL
 					Setting->SetDisplayName(LOCTEXT("SubtitleBackground_Name", "Background Opacity"));
 					Setting->SetDescriptionRichText(LOCTEXT("SubtitleBackgroundOpacity_Description", "Choose a different background or letterboxing for the subtitles."));
 
-					Setting->SetDynamicGetter(GET_SHARED_SETTINGS_FUNCTION_PATH(GetSubtitlesBackgroundOpacity));
-					Setting->SetDynamicSetter(GET_SHARED_SETTINGS_FUNCTION_PATH(SetSubtitlesBackgroundOpacity));
+					Setting->SetDynamicGetter(GET_SHARED_SETTINGS_NATIVE(GetSubtitlesBackgroundOpacity));
+					Setting->SetDynamicSetter(GET_SHARED_SETTINGS_NATIVE(SetSubtitlesBackgroundOpacity));
 					Setting->SetDefaultValue(GetDefault<ULyraSettingsShared>()->GetSubtitlesBackgroundOpacity());
 					Setting->AddEnumOption(ESubtitleDisplayBackgroundOpacity::Clear, LOCTEXT("ESubtitleBackgroundOpacity_Clear", "Clear"));
 					Setting->AddEnumOption(ESubtitleDisplayBackgroundOpacity::Low, LOCTEXT("ESubtitleBackgroundOpacity_Low", "Low"));
@@ -235,8 +237,8 @@ UGameSettingCollection* ULyraGameSettingRegistry::InitializeAudioSettings(ULyraL
 			Setting->SetDisplayName(LOCTEXT("AudioOutputDevice_Name", "Audio Output Device"));
 			Setting->SetDescriptionRichText(LOCTEXT("AudioOutputDevice_Description", "Changes the audio output device for game audio (not voice chat)."));
 
-			Setting->SetDynamicGetter(GET_LOCAL_SETTINGS_FUNCTION_PATH(GetAudioOutputDeviceId));
-			Setting->SetDynamicSetter(GET_LOCAL_SETTINGS_FUNCTION_PATH(SetAudioOutputDeviceId));
+			Setting->SetDynamicGetter(GET_LOCAL_SETTINGS_NATIVE(GetAudioOutputDeviceId));
+			Setting->SetDynamicSetter(GET_LOCAL_SETTINGS_NATIVE(SetAudioOutputDeviceId));
 
 			Setting->AddEditCondition(FWhenPlayingAsPrimaryPlayer::Get());
 			Setting->AddEditCondition(FWhenPlatformHasTrait::KillIfMissing(
@@ -250,11 +252,12 @@ UGameSettingCollection* ULyraGameSettingRegistry::InitializeAudioSettings(ULyraL
 		{
 			UGameSettingValueDiscreteDynamic_Enum* Setting = NewObject<UGameSettingValueDiscreteDynamic_Enum>();
 			Setting->SetDevName(TEXT("BackgroundAudio"));
+			Setting->AddApplyCategory(LyraSettingApplyCategories::BackgroundAudio);
 			Setting->SetDisplayName(LOCTEXT("BackgroundAudio_Name", "Background Audio"));
 			Setting->SetDescriptionRichText(LOCTEXT("BackgroundAudio_Description", "Turns game audio on/off when the game is in the background. When on, the game audio will continue to play when the game is minimized, or another window is focused."));
 
-			Setting->SetDynamicGetter(GET_SHARED_SETTINGS_FUNCTION_PATH(GetAllowAudioInBackgroundSetting));
-			Setting->SetDynamicSetter(GET_SHARED_SETTINGS_FUNCTION_PATH(SetAllowAudioInBackgroundSetting));
+			Setting->SetDynamicGetter(GET_SHARED_SETTINGS_NATIVE(GetAllowAudioInBackgroundSetting));
+			Setting->SetDynamicSetter(GET_SHARED_SETTINGS_NATIVE(SetAllowAudioInBackgroundSetting));
 			Setting->SetDefaultValue(GetDefault<ULyraSettingsShared>()->GetAllowAudioInBackgroundSetting());
 
 			Setting->AddEnumOption(ELyraAllowBackgroundAudioSetting::Off, LOCTEXT("ELyraAllowBackgroundAudioSetting_Off", "Off"));
@@ -272,6 +275,7 @@ UGameSettingCollection* ULyraGameSettingRegistry::InitializeAudioSettings(ULyraL
 		{
 			UGameSettingValueDiscreteDynamic_Bool* Setting = NewObject<UGameSettingValueDiscreteDynamic_Bool>();
 			Setting->SetDevName(TEXT("HeadphoneMode"));
+			Setting->AddApplyCategory(LyraSettingApplyCategories::LocalApply);
 			Setting->SetDisplayName(LOCTEXT("HeadphoneMode_Name", "3D Headphones"));
 			Setting->SetDescriptionRichText(LOCTEXT("HeadphoneMode_Description", "Enable binaural audio.  Provides 3D audio spatialization, so you can hear the location of sounds more precisely, including above, below, and behind you. Recommended for use with stereo headphones only."));
 
@@ -300,7 +304,7 @@ UGameSettingCollection* ULyraGameSettingRegistry::InitializeAudioSettings(ULyraL
 			Setting->SetDescriptionRichText(LOCTEXT("HDRAudioMode_Description", "Enable high dynamic range audio. Changes the runtime processing chain to increase the dynamic range of the audio mixdown, appropriate for theater or more cinematic experiences."));
 
 			Setting->SetDynamicGetter(GET_LOCAL_SETTINGS_FUNCTION_PATH(bUseHDRAudioMode));
-			Setting->SetDynamicSetter(GET_LOCAL_SETTINGS_FUNCTION_PATH(SetHDRAudioModeEnabled));
+			Setting->SetDynamicSetter(GET_LOCAL_SETTINGS_NATIVE(SetHDRAudioModeEnabled));
 			Setting->SetDefaultValue(GetDefault<ULyraSettingsLocal>()->IsHDRAudioModeEnabled());
 
 			Setting->AddEditCondition(FWhenPlayingAsPrimaryPlayer::Get());
@@ -20,6 +20,7 @@ UGameSettingCollection* ULyraGameSettingRegistry::InitializeGamepadSettings(ULyr
 {
 	UGameSettingCollection* Screen = NewObject<UGameSettingCollection>();
 	Screen->SetDevName(TEXT("GamepadCollection"));
+	Screen->AddApplyCategory(LyraSettingApplyCategories::SharedSave);
 	Screen->SetDisplayName(LOCTEXT("GamepadCollection_Name", "Gamepad"));
 	Screen->Initialize(InLocalPlayer);
 
@@ -35,10 +36,11 @@ UGameSettingCollection* ULyraGameSettingRegistry::InitializeGamepadSettings(ULyr
 		{
 			UGameSettingValueDiscreteDynamic* Setting = NewObject<UGameSettingValueDiscreteDynamic>();
 			Setting->SetDevName(TEXT("ControllerHardware"));
+			Setting->AddApplyCategory(LyraSettingApplyCategories::LocalSave);
 			Setting->SetDisplayName(LOCTEXT("ControllerHardware_Name", "Controller Hardware"));
 			Setting->SetDescriptionRichText(LOCTEXT("ControllerHardware_Description", "The type of controller you're using."));
-			Setting->SetDynamicGetter(GET_LOCAL_SETTINGS_FUNCTION_PATH(GetControllerPlatform));
-			Setting->SetDynamicSetter(GET_LOCAL_SETTINGS_FUNCTION_PATH(SetControllerPlatform));
+			Setting->SetDynamicGetter(GET_LOCAL_SETTINGS_NATIVE(GetControllerPlatform));
+			Setting->SetDynamicSetter(GET_LOCAL_SETTINGS_NATIVE(SetControllerPlatform));
 			
 			if (UCommonInputPlatformSettings* PlatformInputSettings = UPlatformSettingsManager::Get().GetSettingsForPlatform<UCommonInputPlatformSettings>())
 			{
@@ -80,8 +82,8 @@ UGameSettingCollection* ULyraGameSettingRegistry::InitializeGamepadSettings(ULyr
 			Setting->SetDisplayName(LOCTEXT("GamepadVibration_Name", "Vibration"));
 			Setting->SetDescriptionRichText(LOCTEXT("GamepadVibration_Description", "Turns controller vibration on/off."));
 
-			Setting->SetDynamicGetter(GET_SHARED_SETTINGS_FUNCTION_PATH(GetForceFeedbackEnabled));
-			Setting->SetDynamicSetter(GET_SHARED_SETTINGS_FUNCTION_PATH(SetForceFeedbackEnabled));
+			Setting->SetDynamicGetter(GET_SHARED_SETTINGS_NATIVE(GetForceFeedbackEnabled));
+			Setting->SetDynamicSetter(GET_SHARED_SETTINGS_NATIVE(SetForceFeedbackEnabled));
 			Setting->SetDefaultValue(GetDefault<ULyraSettingsShared>()->GetForceFeedbackEnabled());
 
 			Hardware->AddSetting(Setting);
@@ -93,8 +95,8 @@ UGameSettingCollection* ULyraGameSettingRegistry::InitializeGamepadSettings(ULyr
 			Setting->SetDisplayName(LOCTEXT("InvertVerticalAxis_Gamepad_Name", "Invert Vertical Axis"));
 			Setting->SetDescriptionRichText(LOCTEXT("InvertVerticalAxis_Gamepad_Description", "Enable the inversion of the vertical look axis."));
 
-			Setting->SetDynamicGetter(GET_SHARED_SETTINGS_FUNCTION_PATH(GetInvertVerticalAxis));
-			Setting->SetDynamicSetter(GET_SHARED_SETTINGS_FUNCTION_PATH(SetInvertVerticalAxis));
+			Setting->SetDynamicGetter(GET_SHARED_SETTINGS_NATIVE(GetInvertVerticalAxis));
+			Setting->SetDynamicSetter(GET_SHARED_SETTINGS_NATIVE(SetInvertVerticalAxis));
 			Setting->SetDefaultValue(GetDefault<ULyraSettingsShared>()->GetInvertVerticalAxis());
 
 			Hardware->AddSetting(Setting);
@@ -106,8 +108,8 @@ UGameSettingCollection* ULyraGameSettingRegistry::InitializeGamepadSettings(ULyr
 			Setting->SetDisplayName(LOCTEXT("InvertHorizontalAxis_Gamepad_Name", "Invert Horizontal Axis"));
 			Setting->SetDescriptionRichText(LOCTEXT("InvertHorizontalAxis_Gamepad_Description", "Enable the inversion of the Horizontal look axis."));
 
-			Setting->SetDynamicGetter(GET_SHARED_SETTINGS_FUNCTION_PATH(GetInvertHorizontalAxis));
-			Setting->SetDynamicSetter(GET_SHARED_SETTINGS_FUNCTION_PATH(SetInvertHorizontalAxis));
+			Setting->SetDynamicGetter(GET_SHARED_SETTINGS_NATIVE(GetInvertHorizontalAxis));
+			Setting->SetDynamicSetter(GET_SHARED_SETTINGS_NATIVE(SetInvertHorizontalAxis));
 			Setting->SetDefaultValue(GetDefault<ULyraSettingsShared>()->GetInvertHorizontalAxis());
 
 			Hardware->AddSetting(Setting);
@@ -119,6 +121,7 @@ UGameSettingCollection* ULyraGameSettingRegistry::InitializeGamepadSettings(ULyr
 	{
 		UGameSettingCollection* GamepadBinding = NewObject<UGameSettingCollection>();
 		GamepadBinding->SetDevName(TEXT("GamepadBindingCollection"));
+		GamepadBinding->AddApplyCategory(LyraSettingApplyCategories::Input);
 		GamepadBinding->SetDisplayName(LOCTEXT("GamepadBindingCollection_Name", "Controls"));
 		Screen->AddSetting(GamepadBinding);
 	}
@@ -152,8 +155,8 @@ UGameSettingCollection* ULyraGameSettingRegistry::InitializeGamepadSettings(ULyr
 			Setting->SetDisplayName(LOCTEXT("LookSensitivityPreset_Name", "Look Sensitivity"));
 			Setting->SetDescriptionRichText(LOCTEXT("LookSensitivityPreset_Description", "How quickly your view rotates."));
 			
-			Setting->SetDynamicGetter(GET_SHARED_SETTINGS_FUNCTION_PATH(GetGamepadLookSensitivityPreset));
-			Setting->SetDynamicSetter(GET_SHARED_SETTINGS_FUNCTION_PATH(SetLookSensitivityPreset));
+			Setting->SetDynamicGetter(GET_SHARED_SETTINGS_NATIVE(GetGamepadLookSensitivityPreset));
+			Setting->SetDynamicSetter(GET_SHARED_SETTINGS_NATIVE(SetLookSensitivityPreset));
 			Setting->SetDefaultValue(GetDefault<ULyraSettingsShared>()->GetGamepadLookSensitivityPreset());
 
 			for (int32 PresetIndex = 1; PresetIndex < (int32)ELyraGamepadSensitivity::MAX; PresetIndex++)
@@ -170,8 +173,8 @@ UGameSettingCollection* ULyraGameSettingRegistry::InitializeGamepadSettings(ULyr
 			Setting->SetDisplayName(LOCTEXT("LookSensitivityPresetAds_Name", "Aim Sensitivity (ADS)"));
 			Setting->SetDescriptionRichText(LOCTEXT("LookSensitivityPresetAds_Description", "How quickly your view rotates while aiming down sights (ADS)."));
 			
-			Setting->SetDynamicGetter(GET_SHARED_SETTINGS_FUNCTION_PATH(GetGamepadTargetingSensitivityPreset));
-			Setting->SetDynamicSetter(GET_SHARED_SETTINGS_FUNCTION_PATH(SetGamepadTargetingSensitivityPreset));
+			Setting->SetDynamicGetter(GET_SHARED_SETTINGS_NATIVE(GetGamepadTargetingSensitivityPreset));
+			Setting->SetDynamicSetter(GET_SHARED_SETTINGS_NATIVE(SetGamepadTargetingSensitivityPreset));
 			Setting->SetDefaultValue(GetDefault<ULyraSettingsShared>()->GetGamepadTargetingSensitivityPreset());
 
 			for (int32 PresetIndex = 1; PresetIndex < (int32)ELyraGamepadSensitivity::MAX; PresetIndex++)
@@ -199,8 +202,8 @@ UGameSettingCollection* ULyraGameSettingRegistry::InitializeGamepadSettings(ULyr
 			Setting->SetDisplayName(LOCTEXT("MoveStickDeadZone_Name", "Left Stick DeadZone"));
 			Setting->SetDescriptionRichText(LOCTEXT("MoveStickDeadZone_Description", "Increase or decrease the area surrounding the stick that we ignore input from.  Setting this value too low may result in the character continuing to move even after removing your finger from the stick."));
 
-			Setting->SetDynamicGetter(GET_SHARED_SETTINGS_FUNCTION_PATH(GetGamepadMoveStickDeadZone));
-			Setting->SetDynamicSetter(GET_SHARED_SETTINGS_FUNCTION_PATH(SetGamepadMoveStickDeadZone));
+			Setting->SetDynamicGetter(GET_SHARED_SETTINGS_NATIVE(GetGamepadMoveStickDeadZone));
+			Setting->SetDynamicSetter(GET_SHARED_SETTINGS_NATIVE(SetGamepadMoveStickDeadZone));
 			Setting->SetDefaultValue(GetDefault<ULyraSettingsShared>()->GetGamepadMoveStickDeadZone());
 			Setting->SetDisplayFormat(UGameSettingValueScalarDynamic::ZeroToOnePercent);
 			Setting->SetMinimumLimit(0.05);
@@ -215,8 +218,8 @@ UGameSettingCollection* ULyraGameSettingRegistry::InitializeGamepadSettings(ULyr
 			Setting->SetDisplayName(LOCTEXT("LookStickDeadZone_Name", "Right Stick DeadZone"));
 			Setting->SetDescriptionRichText(LOCTEXT("LookStickDeadZone_Description", "Increase or decrease the area surrounding the stick that we ignore input from.  Setting this value too low may result in the camera continuing to move even after removing your finger from the stick."));
 
-			Setting->SetDynamicGetter(GET_SHARED_SETTINGS_FUNCTION_PATH(GetGamepadLookStickDeadZone));
-			Setting->SetDynamicSetter(GET_SHARED_SETTINGS_FUNCTION_PATH(SetGamepadLookStickDeadZone));
+			Setting->SetDynamicGetter(GET_SHARED_SETTINGS_NATIVE(GetGamepadLookStickDeadZone));
+			Setting->SetDynamicSetter(GET_SHARED_SETTINGS_NATIVE(SetGamepadLookStickDeadZone));
 			Setting->SetDefaultValue(GetDefault<ULyraSettingsShared>()->GetGamepadLookStickDeadZone());
 			Setting->SetDisplayFormat(UGameSettingValueScalarDynamic::ZeroToOnePercent);
 			Setting->SetMinimumLimit(0.05);
@@ -17,6 +17,7 @@ UGameSettingCollection* ULyraGameSettingRegistry::InitializeGameplaySettings(ULy
 {
 	UGameSettingCollection* Screen = NewObject<UGameSettingCollection>();
 	Screen->SetDevName(TEXT("GameplayCollection"));
+	Screen->AddApplyCategory(LyraSettingApplyCategories::LocalSave);
 	Screen->SetDisplayName(LOCTEXT("GameplayCollection_Name", "Gameplay"));
 	Screen->Initialize(InLocalPlayer);
 
@@ -30,6 +31,7 @@ UGameSettingCollection* ULyraGameSettingRegistry::InitializeGameplaySettings(ULy
 		{
 			ULyraSettingValueDiscrete_Language* Setting = NewObject<ULyraSettingValueDiscrete_Language>();
 			Setting->SetDevName(TEXT("Language"));
+			Setting->AddApplyCategory(LyraSettingApplyCategories::Culture);
 			Setting->SetDisplayName(LOCTEXT("LanguageSetting_Name", "Language"));
 			Setting->SetDescriptionRichText(LOCTEXT("LanguageSetting_Description", "The language of the game."));
 			
@@ -60,8 +62,8 @@ UGameSettingCollection* ULyraGameSettingRegistry::InitializeGameplaySettings(ULy
 			Setting->SetDisplayName(LOCTEXT("RecordReplaySetting_Name", "Record Replays"));
 			Setting->SetDescriptionRichText(LOCTEXT("RecordReplaySetting_Description", "Automatically record game replays. Experimental feature, recorded demos may have playback issues."));
 
-			Setting->SetDynamicGetter(GET_LOCAL_SETTINGS_FUNCTION_PATH(ShouldAutoRecordReplays));
-			Setting->SetDynamicSetter(GET_LOCAL_SETTINGS_FUNCTION_PATH(SetShouldAutoRecordReplays));
+			Setting->SetDynamicGetter(GET_LOCAL_SETTINGS_NATIVE(ShouldAutoRecordReplays));
+			Setting->SetDynamicSetter(GET_LOCAL_SETTINGS_NATIVE(SetShouldAutoRecordReplays));
 			Setting->SetDefaultValue(GetDefault<ULyraSettingsLocal>()->ShouldAutoRecordReplays());
 
 			Setting->AddEditCondition(FWhenPlayingAsPrimaryPlayer::Get());
@@ -79,8 +81,8 @@ UGameSettingCollection* ULyraGameSettingRegistry::InitializeGameplaySettings(ULy
 			Setting->SetDisplayName(LOCTEXT("KeepReplayLimitSetting_Name", "Keep Replay Limit"));
 			Setting->SetDescriptionRichText(LOCTEXT("KeepReplayLimitSetting_Description", "Number of saved replays to keep, set to 0 for infinite."));
 
-			Setting->SetDynamicGetter(GET_LOCAL_SETTINGS_FUNCTION_PATH(GetNumberOfReplaysToKeep));
-			Setting->SetDynamicSetter(GET_LOCAL_SETTINGS_FUNCTION_PATH(SetNumberOfReplaysToKeep));
+			Setting->SetDynamicGetter(GET_LOCAL_SETTINGS_NATIVE(GetNumberOfReplaysToKeep));
+			Setting->SetDynamicSetter(GET_LOCAL_SETTINGS_NATIVE(SetNumberOfReplaysToKeep));
 			Setting->SetDefaultValue(GetDefault<ULyraSettingsLocal>()->GetNumberOfReplaysToKeep());
 			for (int32 Index = 0; Index <= 20; Index++)
 			{
@@ -22,6 +22,7 @@ UGameSettingCollection* ULyraGameSettingRegistry::InitializeMouseAndKeyboardSett
 {
 	UGameSettingCollection* Screen = NewObject<UGameSettingCollection>();
 	Screen->SetDevName(TEXT("MouseAndKeyboardCollection"));
+	Screen->AddApplyCategory(LyraSettingApplyCategories::SharedSave);
 	Screen->SetDisplayName(LOCTEXT("MouseAndKeyboardCollection_Name", "Mouse & Keyboard"));
 	Screen->Initialize(InLocalPlayer);
 
@@ -50,8 +51,8 @@ UGameSettingCollection* ULyraGameSettingRegistry::InitializeMouseAndKeyboardSett
 			Setting->SetDisplayName(LOCTEXT("MouseSensitivityYaw_Name", "X-Axis Sensitivity"));
 			Setting->SetDescriptionRichText(LOCTEXT("MouseSensitivityYaw_Description", "Sets the sensitivity of the mouse's horizontal (x) axis. With higher settings the camera will move faster when looking left and right with the mouse."));
 
-			Setting->SetDynamicGetter(GET_SHARED_SETTINGS_FUNCTION_PATH(GetMouseSensitivityX));
-			Setting->SetDynamicSetter(GET_SHARED_SETTINGS_FUNCTION_PATH(SetMouseSensitivityX));
+			Setting->SetDynamicGetter(GET_SHARED_SETTINGS_NATIVE(GetMouseSensitivityX));
+			Setting->SetDynamicSetter(GET_SHARED_SETTINGS_NATIVE(SetMouseSensitivityX));
 			Setting->SetDefaultValue(GetDefault<ULyraSettingsShared>()->GetMouseSensitivityX());
 			Setting->SetDisplayFormat(UGameSettingValueScalarDynamic::RawTwoDecimals);
 			Setting->SetSourceRangeAndStep(TRange<double>(0, 10), 0.01);
@@ -68,8 +69,8 @@ UGameSettingCollection* ULyraGameSettingRegistry::InitializeMouseAndKeyboardSett
 			Setting->SetDisplayName(LOCTEXT("MouseSensitivityPitch_Name", "Y-Axis Sensitivity"));
 			Setting->SetDescriptionRichText(LOCTEXT("MouseSensitivityPitch_Description", "Sets the sensitivity of the mouse's vertical (y) axis. With higher settings the camera will move faster when looking up and down with the mouse."));
 
-			Setting->SetDynamicGetter(GET_SHARED_SETTINGS_FUNCTION_PATH(GetMouseSensitivityY));
-			Setting->SetDynamicSetter(GET_SHARED_SETTINGS_FUNCTION_PATH(SetMouseSensitivityY));
+			Setting->SetDynamicGetter(GET_SHARED_SETTINGS_NATIVE(GetMouseSensitivityY));
+			Setting->SetDynamicSetter(GET_SHARED_SETTINGS_NATIVE(SetMouseSensitivityY));
 			Setting->SetDefaultValue(GetDefault<ULyraSettingsShared>()->GetMouseSensitivityY());
 			Setting->SetDisplayFormat(UGameSettingValueScalarDynamic::RawTwoDecimals);
 			Setting->SetSourceRangeAndStep(TRange<double>(0, 10), 0.01);
@@ -86,8 +87,8 @@ UGameSettingCollection* ULyraGameSettingRegistry::InitializeMouseAndKeyboardSett
 			Setting->SetDisplayName(LOCTEXT("MouseTargetingMultiplier_Name", "Targeting Sensitivity"));
 			Setting->SetDescriptionRichText(LOCTEXT("MouseTargetingMultiplier_Description", "Sets the modifier for reducing mouse sensitivity when targeting. 100% will have no slow down when targeting. Lower settings will have more slow down when targeting."));
 
-			Setting->SetDynamicGetter(GET_SHARED_SETTINGS_FUNCTION_PATH(GetTargetingMultiplier));
-			Setting->SetDynamicSetter(GET_SHARED_SETTINGS_FUNCTION_PATH(SetTargetingMultiplier));
+			Setting->SetDynamicGetter(GET_SHARED_SETTINGS_NATIVE(GetTargetingMultiplier));
+			Setting->SetDynamicSetter(GET_SHARED_SETTINGS_NATIVE(SetTargetingMultiplier));
 			Setting->SetDefaultValue(GetDefault<ULyraSettingsShared>()->GetTargetingMultiplier());
 			Setting->SetDisplayFormat(UGameSettingValueScalarDynamic::RawTwoDecimals);
 			Setting->SetSourceRangeAndStep(TRange<double>(0, 10), 0.01);
@@ -104,8 +105,8 @@ UGameSettingCollection* ULyraGameSettingRegistry::InitializeMouseAndKeyboardSett
 			Setting->SetDisplayName(LOCTEXT("InvertVerticalAxis_Name", "Invert Vertical Axis"));
 			Setting->SetDescriptionRichText(LOCTEXT("InvertVerticalAxis_Description", "Enable the inversion of the vertical look axis."));
 
-			Setting->SetDynamicGetter(GET_SHARED_SETTINGS_FUNCTION_PATH(GetInvertVerticalAxis));
-			Setting->SetDynamicSetter(GET_SHARED_SETTINGS_FUNCTION_PATH(SetInvertVerticalAxis));
+			Setting->SetDynamicGetter(GET_SHARED_SETTINGS_NATIVE(GetInvertVerticalAxis));
+			Setting->SetDynamicSetter(GET_SHARED_SETTINGS_NATIVE(SetInvertVerticalAxis));
 			Setting->SetDefaultValue(GetDefault<ULyraSettingsShared>()->GetInvertVerticalAxis());
 
 			Setting->AddEditCondition(WhenPlatformSupportsMouseAndKeyboard);
@@ -119,8 +120,8 @@ UGameSettingCollection* ULyraGameSettingRegistry::InitializeMouseAndKeyboardSett
 			Setting->SetDisplayName(LOCTEXT("InvertHorizontalAxis_Name", "Invert Horizontal Axis"));
 			Setting->SetDescriptionRichText(LOCTEXT("InvertHorizontalAxis_Description", "Enable the inversion of the Horizontal look axis."));
 
-			Setting->SetDynamicGetter(GET_SHARED_SETTINGS_FUNCTION_PATH(GetInvertHorizontalAxis));
-			Setting->SetDynamicSetter(GET_SHARED_SETTINGS_FUNCTION_PATH(SetInvertHorizontalAxis));
+			Setting->SetDynamicGetter(GET_SHARED_SETTINGS_NATIVE(GetInvertHorizontalAxis));
+			Setting->SetDynamicSetter(GET_SHARED_SETTINGS_NATIVE(SetInvertHorizontalAxis));
 			Setting->SetDefaultValue(GetDefault<ULyraSettingsShared>()->GetInvertHorizontalAxis());
 
 			Setting->AddEditCondition(WhenPlatformSupportsMouseAndKeyboard);
@@ -135,6 +136,7 @@ UGameSettingCollection* ULyraGameSettingRegistry::InitializeMouseAndKeyboardSett
 	{
 		UGameSettingCollection* KeyBinding = NewObject<UGameSettingCollection>();
 		KeyBinding->SetDevName(TEXT("KeyBindingCollection"));
+		KeyBinding->AddApplyCategory(LyraSettingApplyCategories::Input);
 		KeyBinding->SetDisplayName(LOCTEXT("KeyBindingCollection_Name", "Keyboard & Mouse"));
 		Screen->AddSetting(KeyBinding);
 
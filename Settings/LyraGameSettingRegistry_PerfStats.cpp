@@ -120,6 +120,7 @@ void ULyraGameSettingRegistry::AddPerformanceStatPage(UGameSettingCollection* Pe
 
 		UGameSettingCollectionPage* StatsPage = NewObject<UGameSettingCollectionPage>();
 		StatsPage->SetDevName(TEXT("PerfStatsPage"));
+		StatsPage->AddApplyCategory(LyraSettingApplyCategories::LocalSave);
 		StatsPage->SetDisplayName(LOCTEXT("PerfStatsPage_Name", "Performance Stats"));
 		StatsPage->SetDescriptionRichText(LOCTEXT("PerfStatsPage_Description", "Configure the display of performance statistics."));
 		StatsPage->SetNavigationText(LOCTEXT("PerfStatsPage_Navigation", "Edit"));
@@ -285,8 +286,8 @@ void ULyraGameSettingRegistry::AddPerformanceStatPage(UGameSettingCollection* Pe
 				Setting->SetDisplayName(LOCTEXT("InputLatencyTrackingStats_Name", "Enable Latency Tracking Stats"));
 				Setting->SetDescriptionRichText(LOCTEXT("InputLatencyTrackingStats_Description", "Enabling Input Latency stat tracking"));
 
-				Setting->SetDynamicGetter(GET_LOCAL_SETTINGS_FUNCTION_PATH(GetEnableLatencyTrackingStats));
-				Setting->SetDynamicSetter(GET_LOCAL_SETTINGS_FUNCTION_PATH(SetEnableLatencyTrackingStats));
+				Setting->SetDynamicGetter(GET_LOCAL_SETTINGS_NATIVE(GetEnableLatencyTrackingStats));
+				Setting->SetDynamicSetter(GET_LOCAL_SETTINGS_NATIVE(SetEnableLatencyTrackingStats));
 
 				// Set the default value to true if the platform supports latency tracking stats
 				Setting->SetDefaultValue(ULyraSettingsLocal::DoesPlatformSupportLatencyTrackingStats());
@@ -301,8 +302,8 @@ void ULyraGameSettingRegistry::AddPerformanceStatPage(UGameSettingCollection* Pe
 				Setting->SetDisplayName(LOCTEXT("InputLatencyMarkers_Name", "Enable Latency Markers"));
 				Setting->SetDescriptionRichText(LOCTEXT("InputLatencyMarkers_Description", "Enabling Input Latency Markers to flash the screen"));
 
-				Setting->SetDynamicGetter(GET_LOCAL_SETTINGS_FUNCTION_PATH(GetEnableLatencyFlashIndicators));
-				Setting->SetDynamicSetter(GET_LOCAL_SETTINGS_FUNCTION_PATH(SetEnableLatencyFlashIndicators));
+				Setting->SetDynamicGetter(GET_LOCAL_SETTINGS_NATIVE(GetEnableLatencyFlashIndicators));
+				Setting->SetDynamicSetter(GET_LOCAL_SETTINGS_NATIVE(SetEnableLatencyFlashIndicators));
 				Setting->SetDefaultValue(false);
 
 				// Latency markers require the stats to be supported and enabled
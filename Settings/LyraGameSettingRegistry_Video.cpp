@@ -96,6 +96,7 @@ UGameSettingCollection* ULyraGameSettingRegistry::InitializeVideoSettings(ULyraL
 {
 	UGameSettingCollection* Screen = NewObject<UGameSettingCollection>();
 	Screen->SetDevName(TEXT("VideoCollection"));
+	Screen->AddApplyCategory(LyraSettingApplyCategories::LocalApply);
 	Screen->SetDisplayName(LOCTEXT("VideoCollection_Name", "Video"));
 	Screen->Initialize(InLocalPlayer);
 
@@ -114,11 +115,12 @@ UGameSettingCollection* ULyraGameSettingRegistry::InitializeVideoSettings(ULyraL
 		{
 			UGameSettingValueDiscreteDynamic_Enum* Setting = NewObject<UGameSettingValueDiscreteDynamic_Enum>();
 			Setting->SetDevName(TEXT("WindowMode"));
+			Setting->AddApplyCategory(LyraSettingApplyCategories::Resolution);
 			Setting->SetDisplayName(LOCTEXT("WindowMode_Name", "Window Mode"));
 			Setting->SetDescriptionRichText(LOCTEXT("WindowMode_Description", "In Windowed mode you can interact with other windows more easily, and drag the edges of the window to set the size. In Windowed Fullscreen mode you can easily switch between applications. In Fullscreen mode you cannot interact with other windows as easily, but the game will run slightly faster."));
 
-			Setting->SetDynamicGetter(GET_LOCAL_SETTINGS_FUNCTION_PATH(GetFullscreenMode));
-			Setting->SetDynamicSetter(GET_LOCAL_SETTINGS_FUNCTION_PATH(SetFullscreenMode));
+			Setting->SetDynamicGetter(GET_LOCAL_SETTINGS_NATIVE(GetFullscreenMode));
+			Setting->SetDynamicSetter(GET_LOCAL_SETTINGS_NATIVE(SetFullscreenMode));
 			Setting->AddEnumOption(EWindowMode::Fullscreen, LOCTEXT("WindowModeFullscreen", "Fullscreen"));
 			Setting->AddEnumOption(EWindowMode::WindowedFullscreen, LOCTEXT("WindowModeWindowedFullscreen", "Windowed Fullscreen"));
 			Setting->AddEnumOption(EWindowMode::Windowed, LOCTEXT("WindowModeWindowed", "Windowed"));
@@ -133,6 +135,7 @@ UGameSettingCollection* ULyraGameSettingRegistry::InitializeVideoSettings(ULyraL
 		{
 			ULyraSettingValueDiscrete_Resolution* Setting = NewObject<ULyraSettingValueDiscrete_Resolution>();
 			Setting->SetDevName(TEXT("Resolution"));
+			Setting->AddApplyCategory(LyraSettingApplyCategories::Resolution);
 			Setting->SetDisplayName(LOCTEXT("Resolution_Name", "Resolution"));
 			Setting->SetDescriptionRichText(LOCTEXT("Resolution_Description", "Display Resolution determines the size of the window in Windowed mode. In Fullscreen mode, Display Resolution determines the graphics card output resolution, which can result in black bars depending on monitor and graphics card. Display Resolution is inactive in Windowed Fullscreen mode."));
 
@@ -167,11 +170,12 @@ UGameSettingCollection* ULyraGameSettingRegistry::InitializeVideoSettings(ULyraL
 		{
 			UGameSettingValueDiscreteDynamic_Enum* Setting = NewObject<UGameSettingValueDiscreteDynamic_Enum>();
 			Setting->SetDevName(TEXT("ColorBlindMode"));
+			Setting->AddApplyCategory(LyraSettingApplyCategories::SharedSave);
 			Setting->SetDisplayName(LOCTEXT("ColorBlindMode_Name", "Color Blind Mode"));
 			Setting->SetDescriptionRichText(LOCTEXT("ColorBlindMode_Description", "Using the provided images, test out the different color blind modes to find a color correction that works best for you."));
 			
-			Setting->SetDynamicGetter(GET_SHARED_SETTINGS_FUNCTION_PATH(GetColorBlindMode));
-			Setting->SetDynamicSetter(GET_SHARED_SETTINGS_FUNCTION_PATH(SetColorBlindMode));
+			Setting->SetDynamicGetter(GET_SHARED_SETTINGS_NATIVE(GetColorBlindMode));
+			Setting->SetDynamicSetter(GET_SHARED_SETTINGS_NATIVE(SetColorBlindMode));
 			Setting->SetDefaultValue(GetDefault<ULyraSettingsShared>()->GetColorBlindMode());
 			Setting->AddEnumOption(EColorBlindMode::Off, LOCTEXT("ColorBlindRotatorSettingOff", "Off"));
 			Setting->AddEnumOption(EColorBlindMode::Deuteranope, LOCTEXT("ColorBlindRotatorSettingDeuteranope", "Deuteranope"));
@@ -186,11 +190,12 @@ UGameSettingCollection* ULyraGameSettingRegistry::InitializeVideoSettings(ULyraL
 		{
 			UGameSettingValueDiscreteDynamic_Number* Setting = NewObject<UGameSettingValueDiscreteDynamic_Number>();
 			Setting->SetDevName(TEXT("ColorBlindStrength"));
+			Setting->AddApplyCategory(LyraSettingApplyCategories::SharedSave);
 			Setting->SetDisplayName(LOCTEXT("ColorBlindStrength_Name", "Color Blind Strength"));
 			Setting->SetDescriptionRichText(LOCTEXT("ColorBlindStrength_Description", "Using the provided images, test out the different strengths to find a color correction that works best for you."));
 
-			Setting->SetDynamicGetter(GET_SHARED_SETTINGS_FUNCTION_PATH(GetColorBlindStrength));
-			Setting->SetDynamicSetter(GET_SHARED_SETTINGS_FUNCTION_PATH(SetColorBlindStrength));
+			Setting->SetDynamicGetter(GET_SHARED_SETTINGS_NATIVE(GetColorBlindStrength));
+			Setting->SetDynamicSetter(GET_SHARED_SETTINGS_NATIVE(SetColorBlindStrength));
 			Setting->SetDefaultValue(GetDefault<ULyraSettingsShared>()->GetColorBlindStrength());
 			for (int32 Index = 0; Index <= 10; Index++)
 			{
@@ -205,11 +210,12 @@ UGameSettingCollection* ULyraGameSettingRegistry::InitializeVideoSettings(ULyraL
 		{
 			UGameSettingValueScalarDynamic* Setting = NewObject<UGameSettingValueScalarDynamic>();
 			Setting->SetDevName(TEXT("Brightness"));
+			Setting->AddApplyCategory(LyraSettingApplyCategories::LocalSave);
 			Setting->SetDisplayName(LOCTEXT("Brightness_Name", "Brightness"));
 			Setting->SetDescriptionRichText(LOCTEXT("Brightness_Description", "Adjusts the brightness."));
 
-			Setting->SetDynamicGetter(GET_LOCAL_SETTINGS_FUNCTION_PATH(GetDisplayGamma));
-			Setting->SetDynamicSetter(GET_LOCAL_SETTINGS_FUNCTION_PATH(SetDisplayGamma));
+			Setting->SetDynamicGetter(GET_LOCAL_SETTINGS_NATIVE(GetDisplayGamma));
+			Setting->SetDynamicSetter(GET_LOCAL_SETTINGS_NATIVE(SetDisplayGamma));
 			Setting->SetDefaultValue(2.2);
 			Setting->SetDisplayFormat([](double SourceValue, double NormalizedValue) {
 				return FText::Format(LOCTEXT("BrightnessFormat", "{0}%"), (int32)FMath::GetMappedRangeValueClamped(FVector2D(0, 1), FVector2D(50, 150), NormalizedValue));
@@ -251,6 +257,7 @@ UGameSettingCollection* ULyraGameSettingRegistry::InitializeVideoSettings(ULyraL
 	{
 		UGameSettingCollection* GraphicsQuality = NewObject<UGameSettingCollection>();
 		GraphicsQuality->SetDevName(TEXT("GraphicsQuality"));
+		GraphicsQuality->AddApplyCategory(LyraSettingApplyCategories::Scalability);
 		GraphicsQuality->SetDisplayName(LOCTEXT("GraphicsQuality_Name", "Graphics Quality"));
 		Screen->AddSetting(GraphicsQuality);
 
@@ -262,10 +269,11 @@ UGameSettingCollection* ULyraGameSettingRegistry::InitializeVideoSettings(ULyraL
 			// Console-style device profile selection
 			UGameSettingValueDiscreteDynamic* Setting = NewObject<UGameSettingValueDiscreteDynamic>();
 			Setting->SetDevName(TEXT("DeviceProfileSuffix"));
+			Setting->AddApplyCategory(LyraSettingApplyCategories::LocalApply);
 			Setting->SetDisplayName(LOCTEXT("DeviceProfileSuffix_Name", "Quality Presets"));
 			Setting->SetDescriptionRichText(LOCTEXT("DeviceProfileSuffix_Description", "Choose between different quality presets to make a trade off between quality and speed."));
-			Setting->SetDynamicGetter(GET_LOCAL_SETTINGS_FUNCTION_PATH(GetDesiredDeviceProfileQualitySuffix));
-			Setting->SetDynamicSetter(GET_LOCAL_SETTINGS_FUNCTION_PATH(SetDesiredDeviceProfileQualitySuffix));
+			Setting->SetDynamicGetter(GET_LOCAL_SETTINGS_NATIVE(GetDesiredDeviceProfileQualitySuffix));
+			Setting->SetDynamicSetter(GET_LOCAL_SETTINGS_NATIVE(SetDesiredDeviceProfileQualitySuffix));
 
 			const ULyraPlatformSpecificRenderingSettings* PlatformSettings = ULyraPlatformSpecificRenderingSettings::Get();
 
@@ -291,6 +299,7 @@ UGameSettingCollection* ULyraGameSettingRegistry::InitializeVideoSettings(ULyraL
 			MobileFPSType = Setting;
 
 			Setting->SetDevName(TEXT("FrameRateLimit_Mobile"));
+			Setting->AddApplyCategory(LyraSettingApplyCategories::LocalApply);
 			Setting->SetDisplayName(LOCTEXT("FrameRateLimit_Mobile_Name", "Frame Rate Limit"));
 			Setting->SetDescriptionRichText(LOCTEXT("FrameRateLimit_Mobile_Description", "Select a desired framerate. Use this to fine tune performance on your device."));
 
@@ -375,8 +384,8 @@ UGameSettingCollection* ULyraGameSettingRegistry::InitializeVideoSettings(ULyraL
 			Setting->SetDisplayName(LOCTEXT("ResolutionScale_Name", "3D Resolution"));
 			Setting->SetDescriptionRichText(LOCTEXT("ResolutionScale_Description", "3D resolution determines the resolution that objects are rendered in game, but does not affect the main menu.  Lower resolutions can significantly increase frame rate."));
 
-			Setting->SetDynamicGetter(GET_LOCAL_SETTINGS_FUNCTION_PATH(GetResolutionScaleNormalized));
-			Setting->SetDynamicSetter(GET_LOCAL_SETTINGS_FUNCTION_PATH(SetResolutionScaleNormalized));
+			Setting->SetDynamicGetter(GET_LOCAL_SETTINGS_NATIVE(GetResolutionScaleNormalized));
+			Setting->SetDynamicSetter(GET_LOCAL_SETTINGS_NATIVE(SetResolutionScaleNormalized));
 			Setting->SetDisplayFormat(UGameSettingValueScalarDynamic::ZeroToOnePercent);
 
 			Setting->AddEditDependency(AutoSetQuality);
@@ -395,8 +404,8 @@ UGameSettingCollection* ULyraGameSettingRegistry::InitializeVideoSettings(ULyraL
 			Setting->SetDisplayName(LOCTEXT("GlobalIlluminationQuality_Name", "Global Illumination"));
 			Setting->SetDescriptionRichText(LOCTEXT("GlobalIlluminationQuality_Description", "Global Illumination controls the quality of dynamically calculated indirect lighting bounces, sky shadowing and Ambient Occlusion. Settings of 'High' and above use more accurate ray tracing methods to solve lighting, but can reduce performance."));
 
-			Setting->SetDynamicGetter(GET_LOCAL_SETTINGS_FUNCTION_PATH(GetGlobalIlluminationQuality));
-			Setting->SetDynamicSetter(GET_LOCAL_SETTINGS_FUNCTION_PATH(SetGlobalIlluminationQuality));
+			Setting->SetDynamicGetter(GET_LOCAL_SETTINGS_NATIVE(GetGlobalIlluminationQuality));
+			Setting->SetDynamicSetter(GET_LOCAL_SETTINGS_NATIVE(SetGlobalIlluminationQuality));
 			Setting->AddOption(0, LOCTEXT("VisualEffectQualityLow", "Low"));
 			Setting->AddOption(1, LOCTEXT("VisualEffectQualityMedium", "Medium"));
 			Setting->AddOption(2, LOCTEXT("VisualEffectQualityHigh", "High"));
@@ -418,8 +427,8 @@ UGameSettingCollection* ULyraGameSettingRegistry::InitializeVideoSettings(ULyraL
 			Setting->SetDisplayName(LOCTEXT("Shadows_Name", "Shadows"));
 			Setting->SetDescriptionRichText(LOCTEXT("Shadows_Description", "Shadow quality determines the resolution and view distance of dynamic shadows. Shadows improve visual quality and give better depth perception, but can reduce performance."));
 
-			Setting->SetDynamicGetter(GET_LOCAL_SETTINGS_FUNCTION_PATH(GetShadowQuality));
-			Setting->SetDynamicSetter(GET_LOCAL_SETTINGS_FUNCTION_PATH(SetShadowQuality));
+			Setting->SetDynamicGetter(GET_LOCAL_SETTINGS_NATIVE(GetShadowQuality));
+			Setting->SetDynamicSetter(GET_LOCAL_SETTINGS_NATIVE(SetShadowQuality));
 			Setting->AddOption(0, LOCTEXT("ShadowLow", "Off"));
 			Setting->AddOption(1, LOCTEXT("ShadowMedium", "Medium"));
 			Setting->AddOption(2, LOCTEXT("ShadowHigh", "High"));
@@ -441,8 +450,8 @@ UGameSettingCollection* ULyraGameSettingRegistry::InitializeVideoSettings(ULyraL
 			Setting->SetDisplayName(LOCTEXT("AntiAliasing_Name", "Anti-Aliasing"));
 			Setting->SetDescriptionRichText(LOCTEXT("AntiAliasing_Description", "Anti-Aliasing reduces jaggy artifacts along geometry edges. Increasing this setting will make edges look smoother, but can reduce performance. Higher settings mean more anti-aliasing."));
 
-			Setting->SetDynamicGetter(GET_LOCAL_SETTINGS_FUNCTION_PATH(GetAntiAliasingQuality));
-			Setting->SetDynamicSetter(GET_LOCAL_SETTINGS_FUNCTION_PATH(SetAntiAliasingQuality));
+			Setting->SetDynamicGetter(GET_LOCAL_SETTINGS_NATIVE(GetAntiAliasingQuality));
+			Setting->SetDynamicSetter(GET_LOCAL_SETTINGS_NATIVE(SetAntiAliasingQuality));
 			Setting->AddOption(0, LOCTEXT("AntiAliasingLow", "Off"));
 			Setting->AddOption(1, LOCTEXT("AntiAliasingMedium", "Medium"));
 			Setting->AddOption(2, LOCTEXT("AntiAliasingHigh", "High"));
@@ -464,8 +473,8 @@ UGameSettingCollection* ULyraGameSettingRegistry::InitializeVideoSettings(ULyraL
 			Setting->SetDisplayName(LOCTEXT("ViewDistance_Name", "View Distance"));
 			Setting->SetDescriptionRichText(LOCTEXT("ViewDistance_Description", "View distance determines how far away objects are culled for performance."));
 
-			Setting->SetDynamicGetter(GET_LOCAL_SETTINGS_FUNCTION_PATH(GetViewDistanceQuality));
-			Setting->SetDynamicSetter(GET_LOCAL_SETTINGS_FUNCTION_PATH(SetViewDistanceQuality));
+			Setting->SetDynamicGetter(GET_LOCAL_SETTINGS_NATIVE(GetViewDistanceQuality));
+			Setting->SetDynamicSetter(GET_LOCAL_SETTINGS_NATIVE(SetViewDistanceQuality));
 			Setting->AddOption(0, LOCTEXT("ViewDistanceNear", "Near"));
 			Setting->AddOption(1, LOCTEXT("ViewDistanceMedium", "Medium"));
 			Setting->AddOption(2, LOCTEXT("ViewDistanceFar", "Far"));
@@ -488,8 +497,8 @@ UGameSettingCollection* ULyraGameSettingRegistry::InitializeVideoSettings(ULyraL
 
 			Setting->SetDescriptionRichText(LOCTEXT("TextureQuality_Description", "Texture quality determines the resolution of textures in game. Increasing this setting will make objects more detailed, but can reduce performance."));
 
-			Setting->SetDynamicGetter(GET_LOCAL_SETTINGS_FUNCTION_PATH(GetTextureQuality));
-			Setting->SetDynamicSetter(GET_LOCAL_SETTINGS_FUNCTION_PATH(SetTextureQuality));
+			Setting->SetDynamicGetter(GET_LOCAL_SETTINGS_NATIVE(GetTextureQuality));
+			Setting->SetDynamicSetter(GET_LOCAL_SETTINGS_NATIVE(SetTextureQuality));
 			Setting->AddOption(0, LOCTEXT("TextureQualityLow", "Low"));
 			Setting->AddOption(1, LOCTEXT("TextureQualityMedium", "Medium"));
 			Setting->AddOption(2, LOCTEXT("TextureQualityHigh", "High"));
@@ -511,8 +520,8 @@ UGameSettingCollection* ULyraGameSettingRegistry::InitializeVideoSettings(ULyraL
 			Setting->SetDisplayName(LOCTEXT("VisualEffectQuality_Name", "Effects"));
 			Setting->SetDescriptionRichText(LOCTEXT("VisualEffectQuality_Description", "Effects determines the quality of visual effects and lighting in game. Increasing this setting will increase the quality of visual effects, but can reduce performance."));
 
-			Setting->SetDynamicGetter(GET_LOCAL_SETTINGS_FUNCTION_PATH(GetVisualEffectQuality));
-			Setting->SetDynamicSetter(GET_LOCAL_SETTINGS_FUNCTION_PATH(SetVisualEffectQuality));
+			Setting->SetDynamicGetter(GET_LOCAL_SETTINGS_NATIVE(GetVisualEffectQuality));
+			Setting->SetDynamicSetter(GET_LOCAL_SETTINGS_NATIVE(SetVisualEffectQuality));
 			Setting->AddOption(0, LOCTEXT("VisualEffectQualityLow", "Low"));
 			Setting->AddOption(1, LOCTEXT("VisualEffectQualityMedium", "Medium"));
 			Setting->AddOption(2, LOCTEXT("VisualEffectQualityHigh", "High"));
@@ -534,8 +543,8 @@ UGameSettingCollection* ULyraGameSettingRegistry::InitializeVideoSettings(ULyraL
 			Setting->SetDisplayName(LOCTEXT("ReflectionQuality_Name", "Reflections"));
 			Setting->SetDescriptionRichText(LOCTEXT("ReflectionQuality_Description", "Reflection quality determines the resolution and accuracy of reflections.  Settings of 'High' and above use more accurate ray tracing methods to solve reflections, but can reduce performance."));
 
-			Setting->SetDynamicGetter(GET_LOCAL_SETTINGS_FUNCTION_PATH(GetReflectionQuality));
-			Setting->SetDynamicSetter(GET_LOCAL_SETTINGS_FUNCTION_PATH(SetReflectionQuality));
+			Setting->SetDynamicGetter(GET_LOCAL_SETTINGS_NATIVE(GetReflectionQuality));
+			Setting->SetDynamicSetter(GET_LOCAL_SETTINGS_NATIVE(SetReflectionQuality));
 			Setting->AddOption(0, LOCTEXT("VisualEffectQualityLow", "Low"));
 			Setting->AddOption(1, LOCTEXT("VisualEffectQualityMedium", "Medium"));
 			Setting->AddOption(2, LOCTEXT("VisualEffectQualityHigh", "High"));
@@ -557,8 +566,8 @@ UGameSettingCollection* ULyraGameSettingRegistry::InitializeVideoSettings(ULyraL
 			Setting->SetDisplayName(LOCTEXT("PostProcessingQuality_Name", "Post Processing"));
 			Setting->SetDescriptionRichText(LOCTEXT("PostProcessingQuality_Description", "Post Processing effects include Motion Blur, Depth of Field and Bloom. Increasing this setting improves the quality of post process effects, but can reduce performance."));  
 
-			Setting->SetDynamicGetter(GET_LOCAL_SETTINGS_FUNCTION_PATH(GetPostProcessingQuality));
-			Setting->SetDynamicSetter(GET_LOCAL_SETTINGS_FUNCTION_PATH(SetPostProcessingQuality));
+			Setting->SetDynamicGetter(GET_LOCAL_SETTINGS_NATIVE(GetPostProcessingQuality));
+			Setting->SetDynamicSetter(GET_LOCAL_SETTINGS_NATIVE(SetPostProcessingQuality));
 			Setting->AddOption(0, LOCTEXT("PostProcessingQualityLow", "Low"));
 			Setting->AddOption(1, LOCTEXT("PostProcessingQualityMedium", "Medium"));
 			Setting->AddOption(2, LOCTEXT("PostProcessingQualityHigh", "High"));
@@ -591,8 +600,8 @@ UGameSettingCollection* ULyraGameSettingRegistry::InitializeVideoSettings(ULyraL
 			Setting->SetDisplayName(LOCTEXT("VerticalSync_Name", "Vertical Sync"));
 			Setting->SetDescriptionRichText(LOCTEXT("VerticalSync_Description", "Enabling Vertical Sync eliminates screen tearing by always rendering and presenting a full frame. Disabling Vertical Sync can give higher frame rate and better input response, but can result in horizontal screen tearing."));
 
-			Setting->SetDynamicGetter(GET_LOCAL_SETTINGS_FUNCTION_PATH(IsVSyncEnabled));
-			Setting->SetDynamicSetter(GET_LOCAL_SETTINGS_FUNCTION_PATH(SetVSyncEnabled));
+			Setting->SetDynamicGetter(GET_LOCAL_SETTINGS_NATIVE(IsVSyncEnabled));
+			Setting->SetDynamicSetter(GET_LOCAL_SETTINGS_NATIVE(SetVSyncEnabled));
 			Setting->SetDefaultValue(false);
 
 			Setting->AddEditCondition(MakeShared<FGameSettingEditCondition_FramePacingMode>(ELyraFramePacingMode::DesktopStyle));
@@ -628,11 +637,12 @@ void ULyraGameSettingRegistry::InitializeVideoSettings_FrameRates(UGameSettingCo
 	{
 		UGameSettingValueDiscreteDynamic_Number* Setting = NewObject<UGameSettingValueDiscreteDynamic_Number>();
 		Setting->SetDevName(TEXT("FrameRateLimit_OnBattery"));
+		Setting->AddApplyCategory(LyraSettingApplyCategories::LocalSave);
 		Setting->SetDisplayName(LOCTEXT("FrameRateLimit_OnBattery_Name", "Frame Rate Limit (On Battery)"));
 		Setting->SetDescriptionRichText(LOCTEXT("FrameRateLimit_OnBattery_Description", "Frame rate limit when running on battery. Set this lower for a more consistent frame rate or higher for the best experience on faster machines. You may need to disable Vsync to reach high frame rates."));
 
-		Setting->SetDynamicGetter(GET_LOCAL_SETTINGS_FUNCTION_PATH(GetFrameRateLimit_OnBattery));
-		Setting->SetDynamicSetter(GET_LOCAL_SETTINGS_FUNCTION_PATH(SetFrameRateLimit_OnBattery));
+		Setting->SetDynamicGetter(GET_LOCAL_SETTINGS_NATIVE(GetFrameRateLimit_OnBattery));
+		Setting->SetDynamicSetter(GET_LOCAL_SETTINGS_NATIVE(SetFrameRateLimit_OnBattery));
 		Setting->SetDefaultValue(GetDefault<ULyraSettingsLocal>()->GetFrameRateLimit_OnBattery());
 
 		Setting->AddEditCondition(MakeShared<FGameSettingEditCondition_FramePacingMode>(ELyraFramePacingMode::DesktopStyle));
@@ -646,11 +656,12 @@ void ULyraGameSettingRegistry::InitializeVideoSettings_FrameRates(UGameSettingCo
 	{
 		UGameSettingValueDiscreteDynamic_Number* Setting = NewObject<UGameSettingValueDiscreteDynamic_Number>();
 		Setting->SetDevName(TEXT("FrameRateLimit_InMenu"));
+		Setting->AddApplyCategory(LyraSettingApplyCategories::LocalSave);
 		Setting->SetDisplayName(LOCTEXT("FrameRateLimit_InMenu_Name", "Frame Rate Limit (Menu)"));
 		Setting->SetDescriptionRichText(LOCTEXT("FrameRateLimit_InMenu_Description", "Frame rate limit when in the menu. Set this lower for a more consistent frame rate or higher for the best experience on faster machines. You may need to disable Vsync to reach high frame rates."));
 
-		Setting->SetDynamicGetter(GET_LOCAL_SETTINGS_FUNCTION_PATH(GetFrameRateLimit_InMenu));
-		Setting->SetDynamicSetter(GET_LOCAL_SETTINGS_FUNCTION_PATH(SetFrameRateLimit_InMenu));
+		Setting->SetDynamicGetter(GET_LOCAL_SETTINGS_NATIVE(GetFrameRateLimit_InMenu));
+		Setting->SetDynamicSetter(GET_LOCAL_SETTINGS_NATIVE(SetFrameRateLimit_InMenu));
 		Setting->SetDefaultValue(GetDefault<ULyraSettingsLocal>()->GetFrameRateLimit_InMenu());
 		Setting->AddEditCondition(MakeShared<FGameSettingEditCondition_FramePacingMode>(ELyraFramePacingMode::DesktopStyle));
 
@@ -662,11 +673,12 @@ void ULyraGameSettingRegistry::InitializeVideoSettings_FrameRates(UGameSettingCo
 	{
 		UGameSettingValueDiscreteDynamic_Number* Setting = NewObject<UGameSettingValueDiscreteDynamic_Number>();
 		Setting->SetDevName(TEXT("FrameRateLimit_WhenBackgrounded"));
+		Setting->AddApplyCategory(LyraSettingApplyCategories::LocalSave);
 		Setting->SetDisplayName(LOCTEXT("FrameRateLimit_WhenBackgrounded_Name", "Frame Rate Limit (Background)"));
 		Setting->SetDescriptionRichText(LOCTEXT("FrameRateLimit_WhenBackgrounded_Description", "Frame rate limit when in the background. Set this lower for a more consistent frame rate or higher for the best experience on faster machines. You may need to disable Vsync to reach high frame rates."));
 
-		Setting->SetDynamicGetter(GET_LOCAL_SETTINGS_FUNCTION_PATH(GetFrameRateLimit_WhenBackgrounded));
-		Setting->SetDynamicSetter(GET_LOCAL_SETTINGS_FUNCTION_PATH(SetFrameRateLimit_WhenBackgrounded));
+		Setting->SetDynamicGetter(GET_LOCAL_SETTINGS_NATIVE(GetFrameRateLimit_WhenBackgrounded));
+		Setting->SetDynamicSetter(GET_LOCAL_SETTINGS_NATIVE(SetFrameRateLimit_WhenBackgrounded));
 		Setting->SetDefaultValue(GetDefault<ULyraSettingsLocal>()->GetFrameRateLimit_WhenBackgrounded());
 		Setting->AddEditCondition(MakeShared<FGameSettingEditCondition_FramePacingMode>(ELyraFramePacingMode::DesktopStyle));
 
@@ -678,11 +690,12 @@ void ULyraGameSettingRegistry::InitializeVideoSettings_FrameRates(UGameSettingCo
 	{
 		UGameSettingValueDiscreteDynamic_Number* Setting = NewObject<UGameSettingValueDiscreteDynamic_Number>();
 		Setting->SetDevName(TEXT("FrameRateLimit_Always"));
+		Setting->AddApplyCategory(LyraSettingApplyCategories::LocalSave);
 		Setting->SetDisplayName(LOCTEXT("FrameRateLimit_Always_Name", "Frame Rate Limit"));
 		Setting->SetDescriptionRichText(LOCTEXT("FrameRateLimit_Always_Description", "Frame rate limit sets the highest frame rate that is allowed. Set this lower for a more consistent frame rate or higher for the best experience on faster machines. You may need to disable Vsync to reach high frame rates."));
 
-		Setting->SetDynamicGetter(GET_LOCAL_SETTINGS_FUNCTION_PATH(GetFrameRateLimit_Always));
-		Setting->SetDynamicSetter(GET_LOCAL_SETTINGS_FUNCTION_PATH(SetFrameRateLimit_Always));
+		Setting->SetDynamicGetter(GET_LOCAL_SETTINGS_NATIVE(GetFrameRateLimit_Always));
+		Setting->SetDynamicSetter(GET_LOCAL_SETTINGS_NATIVE(SetFrameRateLimit_Always));
 		Setting->SetDefaultValue(GetDefault<ULyraSettingsLocal>()->GetFrameRateLimit_Always());
 		Setting->AddEditCondition(MakeShared<FGameSettingEditCondition_FramePacingMode>(ELyraFramePacingMode::DesktopStyle));
 
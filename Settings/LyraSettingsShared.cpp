@@ -104,7 +104,11 @@ void ULyraSettingsShared::ApplySettings()
 	ApplySubtitleOptions();
 	ApplyBackgroundAudioSettings();
 	ApplyCultureSettings();
+	ApplyInputSettings();
+}
 
+void ULyraSettingsShared::ApplyInputSettings()
+{
 	if (UEnhancedInputLocalPlayerSubsystem* System = ULocalPlayer::GetSubsystem<UEnhancedInputLocalPlayerSubsystem>(OwningPlayer))
 	{
 		if (UEnhancedInputUserSettings* InputSettings = System->GetUserSettings())
@@ -96,6 +96,9 @@ public:
 
 	/** Applies the current settings to the player */
 	void ApplySettings();
+
+	/** Applies just the enhanced input user settings, e.g. key bindings */
+	void ApplyInputSettings();
 	
 public:
 	////////////////////////////////////////////////////////